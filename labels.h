@@ -0,0 +1,85 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        Pre-rendered labels
+ * -------------------------------------------------------------------------------------+
+ * @source      Generated by tools/labelgen.py from labels.txt, do not edit
+ *
+ * @file        labels.h
+ * @tested      AVR Atmega328p
+ *
+ * @depend      avr/pgmspace.h
+ * -------------------------------------------------------------------------------------+
+ * @descr       Columns of 5x8 font as sent by SSD1306_DrawString: {width, columns}
+ * -------------------------------------------------------------------------------------+
+ * @usage       SSD1306_DrawLabel (LABEL_NAME)
+ */
+
+#ifndef __LABELS_H__
+#define __LABELS_H__
+
+  // includes
+  #include <avr/pgmspace.h>
+
+  // "VS10XX AUDIO CODEC", NORMAL, 109 B
+  static const uint8_t LABEL_TITLE[] PROGMEM = {
+    108,
+    0x1f, 0x20, 0x40, 0x20, 0x1f, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x00, 0x42, 0x7f, 0x40,
+    0x00, 0x00, 0x3e, 0x51, 0x49, 0x45, 0x3e, 0x00, 0x63, 0x14, 0x08, 0x14, 0x63, 0x00, 0x63, 0x14,
+    0x08, 0x14, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x11, 0x11, 0x11, 0x7e, 0x00,
+    0x3f, 0x40, 0x40, 0x40, 0x3f, 0x00, 0x7f, 0x41, 0x41, 0x22, 0x1c, 0x00, 0x00, 0x41, 0x7f, 0x41,
+    0x00, 0x00, 0x3e, 0x41, 0x41, 0x41, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x41,
+    0x41, 0x41, 0x22, 0x00, 0x3e, 0x41, 0x41, 0x41, 0x3e, 0x00, 0x7f, 0x41, 0x41, 0x22, 0x1c, 0x00,
+    0x7f, 0x49, 0x49, 0x49, 0x41, 0x00, 0x3e, 0x41, 0x41, 0x41, 0x22, 0x00,
+  };
+
+  // "VS10XX init", NORMAL, 67 B
+  static const uint8_t LABEL_INIT[] PROGMEM = {
+    66,
+    0x1f, 0x20, 0x40, 0x20, 0x1f, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x00, 0x42, 0x7f, 0x40,
+    0x00, 0x00, 0x3e, 0x51, 0x49, 0x45, 0x3e, 0x00, 0x63, 0x14, 0x08, 0x14, 0x63, 0x00, 0x63, 0x14,
+    0x08, 0x14, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00,
+    0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x04, 0x3f, 0x44, 0x40,
+    0x20, 0x00,
+  };
+
+  // "VS10XX memtest", NORMAL, 85 B
+  static const uint8_t LABEL_MEMTEST[] PROGMEM = {
+    84,
+    0x1f, 0x20, 0x40, 0x20, 0x1f, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x00, 0x42, 0x7f, 0x40,
+    0x00, 0x00, 0x3e, 0x51, 0x49, 0x45, 0x3e, 0x00, 0x63, 0x14, 0x08, 0x14, 0x63, 0x00, 0x63, 0x14,
+    0x08, 0x14, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x04, 0x18, 0x04, 0x78, 0x00,
+    0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x7c, 0x04, 0x18, 0x04, 0x78, 0x00, 0x04, 0x3f, 0x44, 0x40,
+    0x20, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x48, 0x54, 0x54, 0x54, 0x20, 0x00, 0x04, 0x3f,
+    0x44, 0x40, 0x20, 0x00,
+  };
+
+  // "VS10XX sinetest", NORMAL, 91 B
+  static const uint8_t LABEL_SINETEST[] PROGMEM = {
+    90,
+    0x1f, 0x20, 0x40, 0x20, 0x1f, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x00, 0x42, 0x7f, 0x40,
+    0x00, 0x00, 0x3e, 0x51, 0x49, 0x45, 0x3e, 0x00, 0x63, 0x14, 0x08, 0x14, 0x63, 0x00, 0x63, 0x14,
+    0x08, 0x14, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x54, 0x54, 0x54, 0x20, 0x00,
+    0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x38, 0x54, 0x54, 0x54,
+    0x18, 0x00, 0x04, 0x3f, 0x44, 0x40, 0x20, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x48, 0x54,
+    0x54, 0x54, 0x20, 0x00, 0x04, 0x3f, 0x44, 0x40, 0x20, 0x00,
+  };
+
+  // "VS10XX say hello", NORMAL, 97 B
+  static const uint8_t LABEL_HELLO[] PROGMEM = {
+    96,
+    0x1f, 0x20, 0x40, 0x20, 0x1f, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x00, 0x42, 0x7f, 0x40,
+    0x00, 0x00, 0x3e, 0x51, 0x49, 0x45, 0x3e, 0x00, 0x63, 0x14, 0x08, 0x14, 0x63, 0x00, 0x63, 0x14,
+    0x08, 0x14, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x54, 0x54, 0x54, 0x20, 0x00,
+    0x20, 0x54, 0x54, 0x54, 0x78, 0x00, 0x0c, 0x50, 0x50, 0x50, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7f, 0x08, 0x04, 0x04, 0x78, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, 0x41,
+    0x7f, 0x40, 0x00, 0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00,
+  };
+
+  // "[OK]", NORMAL, 25 B
+  static const uint8_t LABEL_OK[] PROGMEM = {
+    24,
+    0x00, 0x7f, 0x41, 0x41, 0x00, 0x00, 0x3e, 0x41, 0x41, 0x41, 0x3e, 0x00, 0x7f, 0x08, 0x14, 0x22,
+    0x41, 0x00, 0x00, 0x41, 0x41, 0x7f, 0x00, 0x00,
+  };
+
+#endif
@@ -0,0 +1,453 @@
+/**
+ * --------------------------------------------------------------------------------------+
+ * @brief       Seek index - sparse time to byte offset table built while streaming
+ * --------------------------------------------------------------------------------------+
+ * @date        18.10.2026
+ * @file        index.c
+ * @version     1.0
+ * @test        AVR Atmega328p
+ *
+ * @depend      index.h
+ * --------------------------------------------------------------------------------------+
+ * @descr       MPEG audio header  FFF? | version, layer | bitrate, rate, padding | ...
+ *              Ogg page header    OggS | version | type | granule (8 B) | serial | seq
+ *                                 | crc | segments | segment table -> body size
+ */
+
+// include libraries
+#include <avr/pgmspace.h>
+#include "index.h"
+
+// Scan states
+#define INDEX_HEAD                0       // collecting header
+#define INDEX_SEGS                1       // collecting Ogg segment table
+
+// Bitrates in kbit/s / 8: MPEG1 layer I, II, III, MPEG2/2.5 layer I, II & III
+const uint8_t INDEX_BITRATES[5][15] PROGMEM = {
+  { 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56 },
+  { 0, 4, 6, 7, 8, 10, 12, 14, 16, 20, 24, 28, 32, 40, 48 },
+  { 0, 4, 5, 6, 7, 8, 10, 12, 14, 16, 20, 24, 28, 32, 40 },
+  { 0, 4, 6, 7, 8, 10, 12, 14, 16, 18, 20, 22, 24, 28, 32 },
+  { 0, 1, 2, 3, 4, 5, 6, 7, 8, 10, 12, 14, 16, 18, 20 }
+};
+
+// Sample rates of MPEG1, MPEG2 is half, MPEG2.5 quarter
+const uint16_t INDEX_RATES[3] PROGMEM = { 44100, 48000, 32000 };
+
+struct INDEX_Entry _idx[INDEX_ENTRIES];                 // @var global - index
+uint8_t _idxEntries;                                    // @var global - entries of index
+uint16_t _idxNext;                                      // @var global - time of next entry
+uint16_t _idxStep;                                      // @var global - spacing of entries
+
+uint8_t _idxMode;                                       // @var global - format
+uint8_t _idxState;                                      // @var global - scan state
+uint8_t _idxHead[27];                                   // @var global - header bytes
+uint8_t _idxCount;                                      // @var global - header bytes collected
+uint32_t _idxSkip;                                      // @var global - body bytes to skip
+uint32_t _idxStart;                                     // @var global - offset of header
+uint32_t _idxOffset;                                    // @var global - scanned frontier
+uint32_t _idxSamples;                                   // @var global - samples before header
+uint32_t _idxRate;                                      // @var global - sample rate
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @brief   Time of samples
+ *
+ * @param   uint32_t samples
+ *
+ * @return  uint16_t ticks
+ */
+static uint16_t INDEX_Time (uint32_t samples)
+{
+  uint32_t ticks;
+
+  if (!_idxRate) {
+    return 0;                                           // rate not known yet
+  }
+  ticks = (samples / _idxRate) * INDEX_TICKS + ((samples % _idxRate) * INDEX_TICKS) / _idxRate;
+
+  return (ticks > 0xFFFF) ? 0xFFFF : (uint16_t) ticks;
+}
+
+/**
+ * @brief   Mark header at _idxStart - entry if spacing passed, full index keeps
+ *          every other entry and doubles spacing
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void INDEX_Mark (void)
+{
+  uint16_t time = INDEX_Time (_idxSamples);
+  uint8_t i;
+
+  if (_idxEntries && (time < _idxNext)) {
+    return;                                             // spacing not passed
+  }
+  if (_idxEntries == INDEX_ENTRIES) {
+    for (i = 1; i < (INDEX_ENTRIES >> 1); i++) {
+      _idx[i] = _idx[i << 1];                           // keep even entries
+    }
+    _idxEntries = INDEX_ENTRIES >> 1;
+    _idxStep <<= 1;                                     // double spacing
+    _idxNext = _idx[_idxEntries - 1].time + _idxStep;
+    if (time < _idxNext) {
+      return;
+    }
+  }
+  _idx[_idxEntries].time = time;
+  _idx[_idxEntries].offset = _idxStart;
+  _idxEntries++;
+  _idxNext = time + _idxStep;
+}
+
+/**
+ * @brief   MPEG audio frame header
+ *
+ * @param   uint16_t * samples per frame
+ * @param   uint32_t * sample rate
+ *
+ * @return  uint16_t frame length, 0 not valid
+ */
+static uint16_t INDEX_Mp3Frame (uint16_t * samples, uint32_t * rate)
+{
+  uint8_t version = (_idxHead[1] >> 3) & 0x03;          // 0 MPEG2.5, 2 MPEG2, 3 MPEG1
+  uint8_t layer = 4 - ((_idxHead[1] >> 1) & 0x03);      // 1 ... 3, 4 reserved
+  uint8_t bitrate = _idxHead[2] >> 4;
+  uint8_t fs = (_idxHead[2] >> 2) & 0x03;
+  uint8_t padding = (_idxHead[2] >> 1) & 0x01;
+  uint32_t kbps;
+
+  if ((version == 1) || (layer == 4) || (bitrate == 0) || (bitrate == 15) || (fs == 3)) {
+    return 0;                                           // reserved, free format, bad
+  }
+  kbps = (uint32_t) pgm_read_byte (&INDEX_BITRATES[(version == 3) ? layer - 1 : ((layer == 1) ? 3 : 4)][bitrate]) << 3;
+  *rate = pgm_read_word (&INDEX_RATES[fs]) >> ((version == 3) ? 0 : ((version == 2) ? 1 : 2));
+
+  if (layer == 1) {
+    *samples = 384;
+    return (uint16_t) (((12000UL * kbps / *rate) + padding) << 2);
+  }
+  if ((layer == 3) && (version != 3)) {
+    *samples = 576;
+    return (uint16_t) ((72000UL * kbps / *rate) + padding);
+  }
+  *samples = 1152;
+  return (uint16_t) ((144000UL * kbps / *rate) + padding);
+}
+
+/**
+ * @brief   MPEG audio byte - header hunted by sync, valid header of the same
+ *          rate marks entry and skips frame; while detecting, first bytes must
+ *          be valid header, else format is unknown
+ *
+ * @param   uint8_t byte
+ *
+ * @return  void
+ */
+static void INDEX_Mp3Byte (uint8_t byte)
+{
+  uint16_t samples;
+  uint16_t length;
+  uint32_t rate;
+
+  if (_idxCount == 0) {
+    if (byte != 0xFF) {
+      if (_idxMode == INDEX_DETECT) {
+        _idxMode = INDEX_OFF;                           // RIFF, fLaC, ASF ...
+      }
+      return;                                           // no sync
+    }
+    _idxStart = _idxOffset;
+  } else if ((_idxCount == 1) && ((byte & 0xE0) != 0xE0)) {
+    if (_idxMode == INDEX_DETECT) {
+      _idxMode = INDEX_OFF;                             // no frame sync
+      return;
+    }
+    _idxCount = 0;
+    if (byte == 0xFF) {                                 // next sync candidate
+      _idxStart = _idxOffset;
+      _idxHead[_idxCount++] = byte;
+    }
+    return;
+  }
+  _idxHead[_idxCount++] = byte;
+  if (_idxCount < 4) {
+    return;
+  }
+  _idxCount = 0;
+  length = INDEX_Mp3Frame (&samples, &rate);
+  if ((length < 4) || (_idxRate && (rate != _idxRate))) {
+    if (_idxMode == INDEX_DETECT) {
+      _idxMode = INDEX_OFF;                             // ADTS, reserved, free format
+    }
+    return;                                             // false sync, hunt on
+  }
+  _idxMode = INDEX_MP3;                                 // valid header decides format
+  _idxRate = rate;
+  INDEX_Mark ();
+  _idxSamples += samples;
+  _idxSkip = length - 4;                                // frame body
+}
+
+/**
+ * @brief   Ogg byte - page header, segment table; granule of page is time of
+ *          next page, sample rate from Vorbis identification header
+ *
+ * @param   uint8_t byte
+ *
+ * @return  void
+ */
+static void INDEX_OggByte (uint8_t byte)
+{
+  const char * capture = "OggS";
+  uint8_t i;
+
+  if (_idxState == INDEX_SEGS) {
+    _idxSkip += byte;                                   // body size
+    if (--_idxCount == 0) {
+      _idxState = INDEX_HEAD;                           // body follows
+    }
+    return;
+  }
+  if ((_idxCount < 4) && (byte != (uint8_t) capture[_idxCount])) {
+    if (!_idxEntries) {
+      _idxMode = INDEX_OFF;                             // stream does not begin by page
+      return;
+    }
+    _idxCount = 0;                                      // hunt on
+    if (byte != 'O') {
+      return;
+    }
+  }
+  if (_idxCount == 0) {
+    _idxStart = _idxOffset;
+  }
+  _idxHead[_idxCount++] = byte;
+  if (_idxCount < 27) {
+    return;
+  }
+  INDEX_Mark ();
+  for (i = 6; (i < 14) && (_idxHead[i] == 0xFF); i++);
+  if (i < 14) {                                         // granule -1 if no packet ends
+    _idxSamples = (uint32_t) _idxHead[6] | ((uint32_t) _idxHead[7] << 8) |
+                  ((uint32_t) _idxHead[8] << 16) | ((uint32_t) _idxHead[9] << 24);
+  }
+  _idxCount = _idxHead[26];                             // segments
+  _idxState = _idxCount ? INDEX_SEGS : INDEX_HEAD;
+}
+
+/**
+ * @brief   Byte of stream
+ *
+ * @param   uint8_t byte
+ *
+ * @return  void
+ */
+static void INDEX_Byte (uint8_t byte)
+{
+  uint32_t size;
+
+  if ((_idxMode == INDEX_DETECT) && !_idxCount) {
+    if (byte == 'I') {
+      _idxMode = INDEX_ID3;
+    } else if (byte == 'O') {
+      _idxMode = INDEX_OGG;
+    }
+  }
+  switch (_idxMode) {
+    case INDEX_ID3:
+      _idxHead[_idxCount++] = byte;
+      if (_idxCount < 10) {
+        return;
+      }
+      _idxCount = 0;
+      if ((_idxHead[1] != 'D') || (_idxHead[2] != '3')) {
+        _idxMode = INDEX_OFF;                           // no tag, unknown format
+        return;
+      }
+      _idxMode = INDEX_DETECT;                          // first frame after tag
+      size = ((uint32_t) (_idxHead[6] & 0x7F) << 21) | ((uint32_t) (_idxHead[7] & 0x7F) << 14) |
+             ((uint16_t) (_idxHead[8] & 0x7F) << 7) | (_idxHead[9] & 0x7F);
+      _idxSkip = size + ((_idxHead[5] & 0x10) ? 10 : 0);  // tag, footer
+      return;
+    case INDEX_DETECT:
+    case INDEX_MP3:
+      INDEX_Mp3Byte (byte);
+      return;
+    case INDEX_OGG:
+      if (!_idxRate && _idxSkip) {                      // body of first pages
+        if (_idxCount < 16) {
+          _idxHead[_idxCount] = byte;
+        }
+        if ((++_idxCount == 16) && (_idxHead[0] == 1) && (_idxHead[1] == 'v')) {
+          _idxRate = (uint32_t) _idxHead[12] | ((uint32_t) _idxHead[13] << 8) |
+                     ((uint32_t) _idxHead[14] << 16) | ((uint32_t) _idxHead[15] << 24);
+        }
+        if (--_idxSkip == 0) {
+          _idxCount = 0;                                // next page
+        }
+        return;
+      }
+      INDEX_OggByte (byte);
+      return;
+  }
+}
+
+/**
+ * +-----------------------------------------------------------------------------------+
+ * |== INDEX FUNCTIONS ================================================================|
+ * +-----------------------------------------------------------------------------------+
+ */
+
+/**
+ * @brief   Init - empty index, next scanned byte is offset 0
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void INDEX_Init (void)
+{
+  _idxEntries = 0;
+  _idxNext = 0;
+  _idxStep = INDEX_STEP;
+  _idxMode = INDEX_DETECT;
+  _idxState = INDEX_HEAD;
+  _idxCount = 0;
+  _idxSkip = 0;
+  _idxOffset = 0;
+  _idxSamples = 0;
+  _idxRate = 0;
+}
+
+/**
+ * @brief   Scan burst - only part continuing scanned frontier is scanned,
+ *          so bursts after jump back are taken once stream reaches frontier
+ *
+ * @param   const uint8_t * burst
+ * @param   uint8_t n bytes
+ * @param   uint32_t offset of burst in stream
+ *
+ * @return  void
+ */
+void INDEX_Scan (const uint8_t * burst, uint8_t n, uint32_t offset)
+{
+  uint8_t i;
+  uint8_t k;
+
+  if ((_idxMode == INDEX_OFF) || (offset > _idxOffset) || ((offset + n) <= _idxOffset)) {
+    return;                                             // unknown format, not at frontier
+  }
+  i = (uint8_t) (_idxOffset - offset);                  // scanned already
+  while (i < n) {
+    if (_idxSkip && (_idxRate || (_idxMode != INDEX_OGG))) {
+      k = n - i;                                        // skip body at once
+      if (k > _idxSkip) {
+        k = (uint8_t) _idxSkip;
+      }
+      _idxSkip -= k;
+      _idxOffset += k;
+      i += k;
+      continue;
+    }
+    INDEX_Byte (burst[i++]);
+    _idxOffset++;
+  }
+}
+
+/**
+ * @brief   Lookup offset of time - interpolated between neighbour entries,
+ *          scanned frontier is the last point
+ *
+ * @param   uint16_t ticks
+ * @param   uint32_t * offset - frontier if time is not scanned yet
+ *
+ * @return  uint8_t 1 from index / 0 out of scanned part
+ */
+uint8_t INDEX_Lookup (uint16_t time, uint32_t * offset)
+{
+  uint16_t t1;
+  uint16_t t2 = INDEX_Time (_idxSamples);               // frontier
+  uint32_t o1;
+  uint32_t o2 = _idxOffset;
+  uint32_t bytes;
+  uint8_t i = _idxEntries;
+
+  if ((_idxMode == INDEX_OFF) || !_idxEntries || (time >= t2)) {
+    *offset = _idxOffset;                               // unknown format, not scanned
+    return 0;
+  }
+  while (--i && (_idx[i].time > time));                 // last entry before
+  t1 = _idx[i].time;
+  o1 = _idx[i].offset;
+  if ((i + 1) < _idxEntries) {
+    t2 = _idx[i + 1].time;
+    o2 = _idx[i + 1].offset;
+  }
+  *offset = o1;
+  if ((time > t1) && (t2 > t1)) {
+    bytes = o2 - o1;                                    // local byte rate, no overflow
+    *offset += (bytes / (t2 - t1)) * (time - t1) + ((bytes % (t2 - t1)) * (time - t1)) / (t2 - t1);
+  }
+  return 1;
+}
+
+/**
+ * @brief   Time of scanned frontier
+ *
+ * @param   void
+ *
+ * @return  uint16_t ticks
+ */
+uint16_t INDEX_End (void)
+{
+  return INDEX_Time (_idxSamples);
+}
+
+/**
+ * @brief   Entries of index
+ *
+ * @param   void
+ *
+ * @return  uint8_t
+ */
+uint8_t INDEX_Entries (void)
+{
+  return _idxEntries;
+}
+
+/**
+ * @brief   Next MP3 frame - frame body is skipped by scan, so next header
+ *          starts where the skip ends
+ *
+ * @param   uint32_t * offset
+ *
+ * @return  uint8_t 1 known / 0 not MP3, not synced or inside header
+ */
+uint8_t INDEX_Frame (uint32_t * offset)
+{
+  if ((_idxMode != INDEX_MP3) || !_idxRate || _idxCount) {
+    return 0;
+  }
+  *offset = _idxOffset + _idxSkip;
+  return 1;
+}
+
+/**
+ * @brief   Format of scanned stream
+ *
+ * @param   void
+ *
+ * @return  uint8_t INDEX_DETECT, INDEX_ID3, INDEX_MP3, INDEX_OGG, INDEX_OFF
+ */
+uint8_t INDEX_Format (void)
+{
+  return _idxMode;
+}
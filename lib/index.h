@@ -0,0 +1,117 @@
+/**
+ * --------------------------------------------------------------------------------------+
+ * @brief       Seek index - sparse time to byte offset table built while streaming
+ * --------------------------------------------------------------------------------------+
+ * @date        18.10.2026
+ * @file        index.h
+ * @version     1.0
+ * @test        AVR Atmega328p
+ *
+ * @depend      avr/pgmspace.h
+ * --------------------------------------------------------------------------------------+
+ * @descr       Bursts sent to decoder are scanned for MPEG audio frame headers (ID3v2
+ *              tag skipped) or Ogg Vorbis page headers, bodies are skipped at once.
+ *              Format is MP3 only if stream (after tag) begins by valid frame header,
+ *              Ogg if it begins by page; anything else (RIFF, fLaC, ASF, ADTS ...)
+ *              is INDEX_OFF - scan stops, lookup and next frame fail.
+ *              Entry is taken every INDEX_TICKS at first, full table keeps every
+ *              other entry and doubles the spacing. Lookup interpolates between
+ *              neighbour entries, last one is the scanned frontier.
+ * --------------------------------------------------------------------------------------+
+ * @usage       INDEX_Init ();
+ *              INDEX_Scan (burst, n, offset);         // every burst sent
+ *              INDEX_Lookup (ticks, &offset);         // 1 if inside scanned part
+ */
+
+#ifndef __INDEX_H__
+#define __INDEX_H__
+
+  // includes
+  #include <stdint.h>
+
+  // Settings
+  #define INDEX_ENTRIES           32      // 6 B each
+  #define INDEX_TICKS             8       // ticks per second, time of entry 1/8 s
+  #define INDEX_STEP              INDEX_TICKS  // first spacing of entries, 1 s
+
+  // Formats
+  #define INDEX_DETECT            0
+  #define INDEX_ID3               1
+  #define INDEX_MP3               2
+  #define INDEX_OGG               3
+  #define INDEX_OFF               4       // unknown format, scan stopped
+
+  // @struct Entry of index
+  struct INDEX_Entry {
+    uint16_t time;                        // ticks of INDEX_TICKS
+    uint32_t offset;                      // frame / page header
+  };
+
+  /**
+   * @brief   Init - empty index, next scanned byte is offset 0
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void INDEX_Init (void);
+
+  /**
+   * @brief   Scan burst - only part continuing scanned frontier is scanned,
+   *          so bursts after jump back are taken once stream reaches frontier
+   *
+   * @param   const uint8_t * burst
+   * @param   uint8_t n bytes
+   * @param   uint32_t offset of burst in stream
+   *
+   * @return  void
+   */
+  void INDEX_Scan (const uint8_t *, uint8_t, uint32_t);
+
+  /**
+   * @brief   Lookup offset of time
+   *
+   * @param   uint16_t ticks
+   * @param   uint32_t * offset - frontier if time is not scanned yet
+   *
+   * @return  uint8_t 1 from index / 0 out of scanned part
+   */
+  uint8_t INDEX_Lookup (uint16_t, uint32_t *);
+
+  /**
+   * @brief   Time of scanned frontier
+   *
+   * @param   void
+   *
+   * @return  uint16_t ticks
+   */
+  uint16_t INDEX_End (void);
+
+  /**
+   * @brief   Entries of index
+   *
+   * @param   void
+   *
+   * @return  uint8_t
+   */
+  uint8_t INDEX_Entries (void);
+
+  /**
+   * @brief   Next MP3 frame - offset of header following scanned frontier
+   *
+   * @param   uint32_t * offset
+   *
+   * @return  uint8_t 1 known / 0 not MP3, not synced or inside header
+   */
+  uint8_t INDEX_Frame (uint32_t *);
+
+  /**
+   * @brief   Format of scanned stream
+   *
+   * @param   void
+   *
+   * @return  uint8_t INDEX_DETECT, INDEX_ID3, INDEX_MP3, INDEX_OGG, INDEX_OFF
+   */
+  uint8_t INDEX_Format (void);
+
+#endif
@@ -0,0 +1,158 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        LCD FONTS 8x16, 16x32 digits (packed)
+ * -------------------------------------------------------------------------------------+
+ * @source      Generated by tools/fontgen.py from DejaVu Sans Mono Bold
+ *
+ * @file        font_large.h
+ * @version     1.0
+ * @tested      AVR Atmega328p
+ *
+ * @depend      avr/pgmspace.h
+ * -------------------------------------------------------------------------------------+
+ * @descr       Glyph bytes are ordered page by page as written to display in horizontal
+ *              addressing mode. Font with index is packed by run-length code:
+ *                0x00 ... 0x7F - (n + 1) literal bytes follow
+ *                0x80 ... 0xFF - next byte repeated (n - 0x80 + 3) times
+ * -------------------------------------------------------------------------------------+
+ * @usage       SSD1306_DrawStringBig (str, &FONT_8X16)
+ */
+
+#ifndef __FONT_LARGE_H__
+#define __FONT_LARGE_H__
+
+  // includes
+  #include <avr/pgmspace.h>
+
+  // @struct Packed font
+  struct FONT_Packed {
+    uint8_t width;                            // columns of glyph
+    uint8_t pages;                            // pages of glyph
+    char first;                               // first character
+    char last;                                // last character
+    const uint16_t * index;                   // glyph offsets in data, 0 if not packed
+    const uint8_t * data;                     // glyphs
+  };
+
+  // 8x16, chars 0x20 ... 0x7e, raw 1520 B (packed would be 1608 B with index)
+  static const uint8_t FONT_8X16_DATA[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 20  
+    0x00, 0x00, 0x7e, 0xfe, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0d, 0x0c, 0x00, 0x00, 0x00, // 21 !
+    0x00, 0x1e, 0x1e, 0x00, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 22 "
+    0x10, 0xf0, 0xfe, 0x1e, 0xf0, 0xfe, 0x1e, 0x10, 0x0f, 0x0f, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x00, // 23 #
+    0x38, 0x7c, 0x64, 0xff, 0xc4, 0xcc, 0x80, 0x00, 0x04, 0x0c, 0x08, 0x3f, 0x08, 0x0f, 0x07, 0x00, // 24 $
+    0xbe, 0xa2, 0x7e, 0x5c, 0xc0, 0xa0, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x08, 0x0f, 0x07, // 25 %
+    0xc0, 0x7c, 0x7e, 0xe2, 0xc2, 0x04, 0xc0, 0xc0, 0x07, 0x0e, 0x08, 0x09, 0x0f, 0x0f, 0x0f, 0x09, // 26 &
+    0x00, 0x00, 0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 27 '
+    0x00, 0x00, 0xf0, 0xfc, 0x0e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1f, 0x38, 0x20, 0x00, 0x00, // 28 (
+    0x00, 0x02, 0x0e, 0xfc, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x20, 0x38, 0x1f, 0x07, 0x00, 0x00, 0x00, // 29 )
+    0x24, 0x3c, 0x18, 0x7e, 0x18, 0x3c, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 2a *
+    0xc0, 0xc0, 0xc0, 0xf8, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, // 2b +
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x0e, 0x00, 0x00, 0x00, // 2c ,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, // 2d -
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00, // 2e .
+    0x00, 0x00, 0x80, 0xe0, 0x78, 0x1e, 0x06, 0x00, 0x18, 0x1e, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, // 2f /
+    0xf8, 0xfc, 0x06, 0x62, 0x06, 0xfc, 0xf8, 0x00, 0x03, 0x07, 0x0c, 0x08, 0x0c, 0x07, 0x03, 0x00, // 30 0
+    0x00, 0x04, 0x02, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x0f, 0x0f, 0x08, 0x08, 0x00, // 31 1
+    0x04, 0x02, 0x02, 0xc2, 0xfe, 0x7c, 0x38, 0x00, 0x0c, 0x0e, 0x0f, 0x0b, 0x09, 0x08, 0x08, 0x00, // 32 2
+    0x04, 0x02, 0x22, 0x22, 0x76, 0xde, 0x8c, 0x00, 0x04, 0x08, 0x08, 0x08, 0x0c, 0x07, 0x07, 0x00, // 33 3
+    0xc0, 0xf0, 0x38, 0x1e, 0xfe, 0xfe, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x00, // 34 4
+    0x7e, 0x3e, 0x22, 0x22, 0x62, 0xc2, 0x80, 0x00, 0x04, 0x08, 0x08, 0x08, 0x0c, 0x07, 0x03, 0x00, // 35 5
+    0xf8, 0xfc, 0x66, 0x22, 0x22, 0xe2, 0xc4, 0x00, 0x03, 0x07, 0x0c, 0x08, 0x08, 0x0f, 0x07, 0x00, // 36 6
+    0x02, 0x02, 0x02, 0xe2, 0xfe, 0x3e, 0x0e, 0x00, 0x00, 0x0c, 0x0f, 0x07, 0x01, 0x00, 0x00, 0x00, // 37 7
+    0xdc, 0xfe, 0x76, 0x22, 0x76, 0xfe, 0xdc, 0x00, 0x07, 0x0f, 0x0c, 0x08, 0x0c, 0x0f, 0x07, 0x00, // 38 8
+    0x7c, 0xfe, 0x82, 0x82, 0xc6, 0xfc, 0xf8, 0x00, 0x00, 0x08, 0x08, 0x08, 0x0c, 0x07, 0x03, 0x00, // 39 9
+    0x00, 0x00, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00, // 3a :
+    0x00, 0x00, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x0e, 0x00, 0x00, 0x00, // 3b ;
+    0xc0, 0xe0, 0xe0, 0x20, 0x30, 0x30, 0x18, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x06, 0x00, // 3c <
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, // 3d =
+    0x18, 0x30, 0x30, 0x30, 0xe0, 0xe0, 0xc0, 0x00, 0x06, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, // 3e >
+    0x00, 0x04, 0xc2, 0xe2, 0x76, 0x1e, 0x0c, 0x00, 0x00, 0x00, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x00, // 3f ?
+    0xf0, 0x18, 0xcc, 0xe4, 0x24, 0x6c, 0xf8, 0xe0, 0x1f, 0x30, 0x67, 0x4e, 0x48, 0x4c, 0x6f, 0x0f, // 40 @
+    0x80, 0xf8, 0xfe, 0x1e, 0xfe, 0xf8, 0x80, 0x00, 0x0f, 0x0f, 0x01, 0x01, 0x01, 0x0f, 0x0f, 0x08, // 41 A
+    0xfe, 0xfe, 0x42, 0x42, 0x66, 0xfe, 0xbc, 0x00, 0x0f, 0x0f, 0x08, 0x08, 0x08, 0x0f, 0x07, 0x00, // 42 B
+    0xf0, 0xfc, 0x1e, 0x06, 0x02, 0x02, 0x04, 0x00, 0x01, 0x07, 0x0f, 0x0c, 0x08, 0x08, 0x04, 0x00, // 43 C
+    0xfe, 0xfe, 0x02, 0x02, 0x06, 0xfc, 0xf8, 0x00, 0x0f, 0x0f, 0x08, 0x08, 0x0c, 0x07, 0x03, 0x00, // 44 D
+    0xfe, 0xfe, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00, 0x0f, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, // 45 E
+    0xfe, 0xfe, 0xfe, 0x42, 0x42, 0x42, 0x42, 0x00, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, // 46 F
+    0xf8, 0xfc, 0x0e, 0x02, 0x82, 0x82, 0x84, 0x00, 0x03, 0x07, 0x0e, 0x08, 0x08, 0x0f, 0x0f, 0x00, // 47 G
+    0xfe, 0xfe, 0x40, 0x40, 0x40, 0xfe, 0xfe, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, // 48 H
+    0x02, 0x02, 0xfe, 0xfe, 0xfe, 0x02, 0x02, 0x00, 0x08, 0x08, 0x0f, 0x0f, 0x0f, 0x08, 0x08, 0x00, // 49 I
+    0x00, 0x00, 0x02, 0x02, 0xfe, 0xfe, 0x00, 0x00, 0x04, 0x08, 0x08, 0x08, 0x0f, 0x07, 0x00, 0x00, // 4a J
+    0xfe, 0xfe, 0xe0, 0xf8, 0xfc, 0x8e, 0x06, 0x02, 0x0f, 0x0f, 0x00, 0x00, 0x03, 0x0f, 0x0e, 0x08, // 4b K
+    0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x08, // 4c L
+    0xfe, 0xfe, 0xfc, 0xe0, 0xfc, 0xfe, 0xfe, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, // 4d M
+    0xfe, 0xfe, 0x3c, 0xf0, 0x80, 0xfe, 0xfe, 0x00, 0x0f, 0x0f, 0x00, 0x01, 0x07, 0x0f, 0x0f, 0x00, // 4e N
+    0xf8, 0xfc, 0x06, 0x02, 0x06, 0xfe, 0xf8, 0x00, 0x03, 0x07, 0x0c, 0x08, 0x0c, 0x0f, 0x03, 0x00, // 4f O
+    0xfe, 0xfe, 0x82, 0x82, 0xc6, 0xfe, 0x7c, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 50 P
+    0xf8, 0xfc, 0x06, 0x02, 0x06, 0xfc, 0xf8, 0x00, 0x03, 0x07, 0x0c, 0x08, 0x1c, 0x3f, 0x17, 0x00, // 51 Q
+    0xfe, 0xfe, 0x82, 0x82, 0xc6, 0xfe, 0x7c, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x03, 0x0f, 0x0e, 0x08, // 52 R
+    0x3c, 0x7e, 0x76, 0xe2, 0xe2, 0xc6, 0x84, 0x00, 0x04, 0x08, 0x08, 0x08, 0x0d, 0x0f, 0x07, 0x00, // 53 S
+    0x02, 0x02, 0xfe, 0xfe, 0xfe, 0x02, 0x02, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, // 54 T
+    0xfe, 0xfe, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x07, 0x0f, 0x0c, 0x08, 0x0c, 0x0f, 0x07, 0x00, // 55 U
+    0x3e, 0xfe, 0xe0, 0x00, 0xe0, 0xfe, 0x3e, 0x02, 0x00, 0x03, 0x0f, 0x0e, 0x0f, 0x03, 0x00, 0x00, // 56 V
+    0xfe, 0x80, 0xf0, 0xf0, 0xf0, 0x80, 0xfe, 0x3e, 0x0f, 0x0f, 0x0f, 0x00, 0x07, 0x0f, 0x0f, 0x00, // 57 W
+    0x06, 0x1e, 0xf8, 0xf0, 0xf8, 0x1e, 0x06, 0x02, 0x0c, 0x0f, 0x03, 0x01, 0x03, 0x0f, 0x0c, 0x08, // 58 X
+    0x0e, 0x3e, 0xf8, 0xe0, 0xf8, 0x3e, 0x0e, 0x02, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, // 59 Y
+    0x02, 0x82, 0xc2, 0xf2, 0xfe, 0x3e, 0x1e, 0x00, 0x0e, 0x0f, 0x0f, 0x09, 0x08, 0x08, 0x08, 0x08, // 5a Z
+    0x00, 0x00, 0xfe, 0xfe, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x20, 0x20, 0x00, 0x00, // 5b [
+    0x06, 0x1e, 0x78, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1e, 0x18, 0x00, // 5c backslash
+    0x00, 0x02, 0x02, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x3f, 0x3f, 0x00, 0x00, 0x00, // 5d ]
+    0x10, 0x1c, 0x0e, 0x06, 0x0e, 0x1c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 5e ^
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, // 5f _
+    0x00, 0x01, 0x03, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 60 `
+    0x00, 0xb0, 0x90, 0x90, 0x90, 0xf0, 0xe0, 0x00, 0x07, 0x0f, 0x09, 0x08, 0x0c, 0x0f, 0x0f, 0x00, // 61 a
+    0xfe, 0xfe, 0x30, 0x10, 0x30, 0xf0, 0xe0, 0x00, 0x0f, 0x0f, 0x0c, 0x08, 0x0c, 0x0f, 0x07, 0x00, // 62 b
+    0xc0, 0xe0, 0xf0, 0x10, 0x10, 0x10, 0x20, 0x00, 0x03, 0x07, 0x0f, 0x08, 0x08, 0x08, 0x04, 0x00, // 63 c
+    0xe0, 0xf0, 0x30, 0x10, 0x30, 0xfe, 0xfe, 0x00, 0x07, 0x0f, 0x0c, 0x08, 0x0c, 0x0f, 0x0f, 0x00, // 64 d
+    0xe0, 0xf0, 0xb0, 0x90, 0x90, 0xf0, 0xe0, 0x00, 0x07, 0x0f, 0x0c, 0x08, 0x08, 0x08, 0x04, 0x00, // 65 e
+    0x10, 0x10, 0xfc, 0xfe, 0x16, 0x12, 0x12, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, // 66 f
+    0xe0, 0xf0, 0x30, 0x10, 0x30, 0xf0, 0xf0, 0x00, 0x07, 0x4f, 0x4c, 0x48, 0x6c, 0x7f, 0x3f, 0x00, // 67 g
+    0xfe, 0xfe, 0x70, 0x10, 0x30, 0xf0, 0xe0, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, // 68 h
+    0x00, 0x10, 0x10, 0xf7, 0xf7, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x0f, 0x0f, 0x08, 0x08, 0x08, // 69 i
+    0x00, 0x10, 0x10, 0xf7, 0xf7, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x7f, 0x3f, 0x00, 0x00, 0x00, // 6a j
+    0xfe, 0xfe, 0xc0, 0xc0, 0xf0, 0x30, 0x10, 0x00, 0x0f, 0x0f, 0x01, 0x01, 0x07, 0x0f, 0x0c, 0x08, // 6b k
+    0x02, 0x02, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x08, 0x08, 0x08, 0x00, // 6c l
+    0xf0, 0x30, 0x30, 0xf0, 0x30, 0x30, 0xf0, 0x80, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x0f, // 6d m
+    0xf0, 0xf0, 0x70, 0x10, 0x30, 0xf0, 0xe0, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, // 6e n
+    0xe0, 0xf0, 0x30, 0x10, 0x30, 0xf0, 0xe0, 0x00, 0x07, 0x0f, 0x0c, 0x08, 0x0c, 0x0f, 0x07, 0x00, // 6f o
+    0xf0, 0xf0, 0x30, 0x10, 0x30, 0xf0, 0xe0, 0x00, 0x7f, 0x7f, 0x0c, 0x08, 0x0c, 0x0f, 0x07, 0x00, // 70 p
+    0xe0, 0xf0, 0x30, 0x10, 0x30, 0xf0, 0xf0, 0x00, 0x07, 0x0f, 0x0c, 0x08, 0x0c, 0x7f, 0x7f, 0x00, // 71 q
+    0x00, 0xf0, 0xf0, 0x70, 0x10, 0x10, 0x10, 0x10, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, // 72 r
+    0x60, 0xf0, 0xf0, 0x90, 0x90, 0xa0, 0x00, 0x00, 0x04, 0x08, 0x09, 0x09, 0x0f, 0x0f, 0x07, 0x00, // 73 s
+    0x10, 0x10, 0xfc, 0xfc, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x08, 0x08, 0x08, 0x00, // 74 t
+    0xf0, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x07, 0x0f, 0x0c, 0x08, 0x0c, 0x0f, 0x0f, 0x00, // 75 u
+    0x70, 0xf0, 0xc0, 0x00, 0xc0, 0xf0, 0x70, 0x00, 0x00, 0x03, 0x0f, 0x0e, 0x0f, 0x03, 0x00, 0x00, // 76 v
+    0xf0, 0x00, 0xc0, 0xc0, 0xc0, 0x00, 0xf0, 0x70, 0x0f, 0x0f, 0x0f, 0x01, 0x0f, 0x0f, 0x0f, 0x00, // 77 w
+    0x10, 0x70, 0xf0, 0xc0, 0xe0, 0x70, 0x10, 0x00, 0x0c, 0x0e, 0x07, 0x03, 0x07, 0x0e, 0x0c, 0x00, // 78 x
+    0x70, 0xf0, 0xc0, 0x00, 0xc0, 0xf0, 0x70, 0x00, 0x40, 0x41, 0x7f, 0x3f, 0x1f, 0x03, 0x00, 0x00, // 79 y
+    0x10, 0x10, 0x90, 0xd0, 0xf0, 0xf0, 0x30, 0x00, 0x0c, 0x0e, 0x0f, 0x0b, 0x09, 0x08, 0x08, 0x00, // 7a z
+    0x00, 0x00, 0xf8, 0xfe, 0x7e, 0x02, 0x02, 0x00, 0x01, 0x01, 0x1f, 0x7f, 0x7c, 0x40, 0x40, 0x00, // 7b {
+    0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, // 7c |
+    0x02, 0x02, 0x7e, 0xfe, 0xf8, 0x00, 0x00, 0x00, 0x40, 0x40, 0x7c, 0x7f, 0x1f, 0x01, 0x01, 0x00, // 7d }
+    0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, // 7e ~
+  };
+
+  // 16x32, chars 0x30 ... 0x3a, 538 B packed with index (raw 704 B)
+  static const uint16_t FONT_16X32_INDEX[] PROGMEM = {
+    0, 65, 95, 141, 188, 230, 278, 336, 375, 437, 498,
+  };
+  static const uint8_t FONT_16X32_DATA[] PROGMEM = {
+    0x0d, 0x00, 0x00, 0x80, 0xe0, 0xf8, 0xf8, 0xfc, 0x7c, 0x7c, 0xfc, 0xfc, 0xf8, 0xf0, 0xc0, 0x80, 0x00, 0x00, 0xf8, 0x80, 0xff, 0x05, 0x7f, 0x80, 0xc0, 0xc0, 0x80, 0x07, 0x80, 0xff, 0x03, 0xfe, 0x00, 0x00, 0x1f, 0x80, 0xff, 0x05, 0xfc, 0x01, 0x07, 0x07, 0x03, 0xe0, 0x80, 0xff, 0x00, 0x7f, 0x80, 0x00, 0x0d, 0x01, 0x07, 0x1f, 0x1f, 0x3f, 0x3e, 0x3e, 0x3f, 0x3f, 0x1f, 0x0f, 0x03, 0x00, 0x00, // 30 0
+    0x02, 0x00, 0x00, 0xf0, 0x81, 0xf8, 0x80, 0xfc, 0x00, 0xf8, 0x89, 0x00, 0x81, 0xff, 0x89, 0x00, 0x81, 0xff, 0x84, 0x00, 0x00, 0x1e, 0x81, 0x3e, 0x81, 0x3f, 0x81, 0x3e, 0x00, 0x00, // 31 1
+    0x03, 0x00, 0x00, 0xf8, 0xf8, 0x82, 0x7c, 0x04, 0xfc, 0xf8, 0xf8, 0xf0, 0xc0, 0x87, 0x00, 0x01, 0x80, 0xe0, 0x80, 0xff, 0x00, 0x3f, 0x81, 0x00, 0x09, 0x80, 0xc0, 0xf0, 0xf8, 0xfc, 0x7f, 0x1f, 0x0f, 0x03, 0x01, 0x82, 0x00, 0x00, 0x1f, 0x81, 0x3f, 0x85, 0x3e, 0x01, 0x00, 0x00, // 32 2
+    0x02, 0x00, 0x00, 0xf8, 0x83, 0x7c, 0x04, 0xfc, 0xfc, 0xf8, 0xf0, 0xe0, 0x84, 0x00, 0x81, 0xe0, 0x04, 0xf0, 0xff, 0xff, 0x3f, 0x1f, 0x84, 0x00, 0x00, 0x01, 0x81, 0x03, 0x08, 0x8f, 0xff, 0xff, 0xfe, 0xf8, 0x00, 0x00, 0x1f, 0x1f, 0x84, 0x3e, 0x05, 0x3f, 0x1f, 0x0f, 0x07, 0x01, 0x00, // 33 3
+    0x83, 0x00, 0x02, 0x80, 0xe0, 0xf8, 0x81, 0xfc, 0x82, 0x00, 0x06, 0x80, 0xe0, 0xf8, 0xfe, 0x3f, 0x0f, 0x03, 0x81, 0xff, 0x81, 0x00, 0x03, 0xfe, 0xff, 0xff, 0xfb, 0x81, 0xf8, 0x81, 0xff, 0x01, 0xf8, 0xf8, 0x87, 0x00, 0x00, 0x1f, 0x80, 0x3f, 0x80, 0x00, // 34 4
+    0x02, 0x00, 0x00, 0xf8, 0x80, 0xfc, 0x84, 0x7c, 0x00, 0x78, 0x81, 0x00, 0x81, 0xff, 0x82, 0xf0, 0x02, 0xe0, 0xc0, 0x80, 0x81, 0x00, 0x80, 0x01, 0x80, 0x00, 0x02, 0x01, 0x03, 0xcf, 0x80, 0xff, 0x04, 0xfc, 0x00, 0x00, 0x0a, 0x1e, 0x83, 0x3e, 0x06, 0x3f, 0x1f, 0x1f, 0x0f, 0x03, 0x00, 0x00, // 35 5
+    0x80, 0x00, 0x04, 0xe0, 0xf0, 0xf8, 0xf8, 0x7c, 0x81, 0x3c, 0x01, 0x7c, 0x78, 0x80, 0x00, 0x00, 0xf0, 0x80, 0xff, 0x01, 0xef, 0xe0, 0x82, 0xf0, 0x01, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x0f, 0x81, 0xff, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x81, 0xff, 0x80, 0x00, 0x04, 0x01, 0x07, 0x1f, 0x1f, 0x3f, 0x80, 0x3c, 0x05, 0x3f, 0x1f, 0x1f, 0x07, 0x01, 0x00, // 36 6
+    0x01, 0x00, 0x78, 0x85, 0x7c, 0x81, 0xfc, 0x00, 0x78, 0x85, 0x00, 0x06, 0x80, 0xf0, 0xfe, 0xff, 0xff, 0x1f, 0x03, 0x84, 0x00, 0x06, 0xc0, 0xf8, 0xff, 0xff, 0x7f, 0x0f, 0x01, 0x85, 0x00, 0x04, 0x3e, 0x3f, 0x3f, 0x1f, 0x07, 0x84, 0x00, // 37 7
+    0x0d, 0x00, 0x00, 0xc0, 0xf0, 0xf8, 0xfc, 0x7c, 0x3c, 0x3c, 0x7c, 0xfc, 0xf8, 0xf0, 0xe0, 0x81, 0x00, 0x03, 0x1f, 0x3f, 0xff, 0xff, 0x81, 0xe0, 0x03, 0xf9, 0xff, 0x3f, 0x1f, 0x80, 0x00, 0x04, 0xf0, 0xfe, 0xff, 0xff, 0x0f, 0x81, 0x03, 0x04, 0x07, 0xff, 0xff, 0xfe, 0xf8, 0x80, 0x00, 0x0d, 0x07, 0x0f, 0x1f, 0x3f, 0x3e, 0x3c, 0x3c, 0x3e, 0x3f, 0x1f, 0x1f, 0x07, 0x01, 0x00, // 38 8
+    0x0d, 0x00, 0x80, 0xe0, 0xf0, 0xf8, 0xfc, 0x7c, 0x3c, 0x3c, 0x7c, 0xf8, 0xf8, 0xf0, 0xc0, 0x80, 0x00, 0x00, 0x7f, 0x80, 0xff, 0x04, 0xc0, 0x80, 0x00, 0x80, 0x80, 0x81, 0xff, 0x00, 0xfc, 0x80, 0x00, 0x01, 0x03, 0x07, 0x83, 0x0f, 0x00, 0xe7, 0x80, 0xff, 0x00, 0x1f, 0x80, 0x00, 0x02, 0x1e, 0x1e, 0x3e, 0x80, 0x3c, 0x07, 0x3e, 0x3f, 0x1f, 0x0f, 0x07, 0x01, 0x00, 0x00, // 39 9
+    0x93, 0x00, 0x81, 0xfc, 0x00, 0x88, 0x88, 0x00, 0x81, 0x81, 0x89, 0x00, 0x81, 0x3f, 0x00, 0x11, 0x82, 0x00, // 3a :
+  };
+
+  // @const Fonts
+  static const struct FONT_Packed FONT_8X16 PROGMEM = { 8, 2, 0x20, 0x7e, 0, FONT_8X16_DATA };
+  static const struct FONT_Packed FONT_16X32 PROGMEM = { 16, 4, 0x30, 0x3a, FONT_16X32_INDEX, FONT_16X32_DATA };
+
+#endif
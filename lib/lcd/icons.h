@@ -0,0 +1,45 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        LCD ICONS (packed)
+ * -------------------------------------------------------------------------------------+
+ * @source      Generated by tools/bmpconv.py from PBM files in tools/icons
+ *
+ * @file        icons.h
+ * @version     1.0
+ * @tested      AVR Atmega328p
+ *
+ * @depend      avr/pgmspace.h
+ * -------------------------------------------------------------------------------------+
+ * @usage       SSD1306_DrawBitmap (x, y, ICON_PLAY)
+ */
+
+#ifndef __ICONS_H__
+#define __ICONS_H__
+
+  // includes
+  #include <avr/pgmspace.h>
+
+  // Generated by tools/bmpconv.py, {width, height, packed pages}
+  // play.pbm, 8x8, 11 B packed (raw 10 B)
+  static const uint8_t ICON_PLAY[] PROGMEM = {
+    8, 8,
+    0x07, 0xff, 0xff, 0x7e, 0x7e, 0x3c, 0x3c, 0x18, 0x18,
+  };
+  // pause.pbm, 8x8, 9 B packed (raw 10 B)
+  static const uint8_t ICON_PAUSE[] PROGMEM = {
+    8, 8,
+    0x80, 0xff, 0x01, 0x00, 0x00, 0x80, 0xff,
+  };
+  // battery.pbm, 16x8, 19 B packed (raw 18 B)
+  static const uint8_t ICON_BATTERY[] PROGMEM = {
+    16, 8,
+    0x0f, 0xff, 0x81, 0xbd, 0xbd, 0x81, 0xbd, 0xbd, 0x81, 0xbd, 0xbd, 0x81, 0xbd, 0xbd, 0xff, 0x3c,
+    0x3c,
+  };
+  // signal.pbm, 12x8, 15 B packed (raw 14 B)
+  static const uint8_t ICON_SIGNAL[] PROGMEM = {
+    12, 8,
+    0x0b, 0x00, 0xc0, 0xc0, 0x00, 0xf0, 0xf0, 0x00, 0xfc, 0xfc, 0x00, 0xff, 0xff,
+  };
+
+#endif
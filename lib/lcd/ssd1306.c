@@ -12,7 +12,7 @@
  * @version     3.0
  * @tested      AVR Atmega328p
  *
- * @depend      font.h, twi.h
+ * @depend      font.h, font_large.h, twi.h, spi.h
  * --------------------------------------------------------------------------------------+
  * @descr       Version 1.0 -> applicable for 1 display
  *              Version 2.0 -> rebuild to 'cacheMemLcd' array
@@ -22,472 +22,1617 @@
  */
 
 // @includes
+#include <string.h>
 #include "ssd1306.h"
 
-// @const uint8_t - List of init commands according to datasheet SSD1306
+// @const uint8_t - List of init commands according to datasheet SSD1306, sent as one
+//                  command stream (control byte 0x00)
 const uint8_t INIT_SSD1306[] PROGMEM = {
-  17,                                                             // number of initializers
-  //SSD1306_RESET, 0,                                               // 0xE4 = Software Reset?
-  SSD1306_DISPLAY_OFF, 0,                                         // 0xAE = Set Display OFF
-  SSD1306_SET_MUX_RATIO, 1, 0x3F,                                 // 0xA8 - 0x3F for 128 x 64 version (64MUX)
+  SSD1306_DISPLAY_OFF,                                            // 0xAE = Set Display OFF
+  SSD1306_SET_MUX_RATIO, 0x3F,                                    // 0xA8 - 0x3F for 128 x 64 version (64MUX)
                                                                   //      - 0x1F for 128 x 32 version (32MUX)
-  SSD1306_MEMORY_ADDR_MODE, 1, 0x00,                              // 0x20 = Set Memory Addressing Mode
+  SSD1306_MEMORY_ADDR_MODE, 0x00,                                 // 0x20 = Set Memory Addressing Mode
                                                                   // 0x00 - Horizontal Addressing Mode
                                                                   // 0x01 - Vertical Addressing Mode
                                                                   // 0x02 - Page Addressing Mode (RESET)
-  SSD1306_SET_START_LINE, 0,                                      // 0x40
-  SSD1306_DISPLAY_OFFSET, 1, 0x00,                                // 0xD3
-  SSD1306_SEG_REMAP_OP, 0,                                        // 0xA0 / remap 0xA1
-  SSD1306_COM_SCAN_DIR_OP, 0,                                     // 0xC0 / remap 0xC8
-  SSD1306_COM_PIN_CONF, 1, 0x12,                                  // 0xDA, 0x12 - Disable COM Left/Right remap, Alternative COM pin configuration
+  SSD1306_SET_START_LINE,                                         // 0x40
+  SSD1306_DISPLAY_OFFSET, 0x00,                                   // 0xD3
+  SSD1306_SEG_REMAP_OP,                                           // 0xA0 / remap 0xA1
+  SSD1306_COM_SCAN_DIR_OP,                                        // 0xC0 / remap 0xC8
+  SSD1306_COM_PIN_CONF, 0x12,                                     // 0xDA, 0x12 - Disable COM Left/Right remap, Alternative COM pin configuration
                                                                   //       0x12 - for 128 x 64 version
                                                                   //       0x02 - for 128 x 32 version
-  SSD1306_SET_CONTRAST, 1, 0x7F,                                  // 0x81, 0x7F - reset value (max 0xFF)
-  SSD1306_DIS_ENT_DISP_ON, 0,                                     // 0xA4
-  SSD1306_DIS_NORMAL, 0,                                          // 0xA6
-  SSD1306_SET_OSC_FREQ, 1, 0x80,                                  // 0xD5, 0x80 => D=1; DCLK = Fosc / D <=> DCLK = Fosc
-  SSD1306_SET_PRECHARGE, 1, 0xc2,                                 // 0xD9, higher value less blinking
+  SSD1306_SET_CONTRAST, 0x7F,                                     // 0x81, 0x7F - reset value (max 0xFF)
+  SSD1306_DIS_ENT_DISP_ON,                                        // 0xA4
+  SSD1306_DIS_NORMAL,                                             // 0xA6
+  SSD1306_SET_OSC_FREQ, 0x80,                                     // 0xD5, 0x80 => D=1; DCLK = Fosc / D <=> DCLK = Fosc
+  SSD1306_SET_PRECHARGE, 0xc2,                                    // 0xD9, higher value less blinking
                                                                   // 0xC2, 1st phase = 2 DCLK,  2nd phase = 13 DCLK
-  SSD1306_VCOM_DESELECT, 1, 0x20,                                 // Set V COMH Deselect, reset value 0x22 = 0,77xUcc
-  SSD1306_SET_CHAR_REG, 1, 0x14,                                  // 0x8D, Enable charge pump during display on
-  SSD1306_DEACT_SCROLL, 0,                                        // 0x2E
-  SSD1306_DISPLAY_ON, 0                                           // 0xAF = Set Display ON
+  SSD1306_VCOM_DESELECT, 0x20,                                    // Set V COMH Deselect, reset value 0x22 = 0,77xUcc
+  SSD1306_SET_CHAR_REG, 0x14,                                     // 0x8D, Enable charge pump during display on
+  SSD1306_DEACT_SCROLL,                                           // 0x2E
+  SSD1306_DISPLAY_ON                                              // 0xAF = Set Display ON
 };
 
 unsigned short int _indexCol = START_COLUMN_ADDR;                 // @var global - cache index column
 unsigned short int _indexPage = START_PAGE_ADDR;                  // @var global - cache index page
 
+void (*_yield) (void) = 0;                                        // @var global - yield before SPI bus taken
+
+#if defined(SSD1306_SPI)
+uint8_t _spiCount = 0;                                            // @var global - bytes of actual burst
+uint8_t _spiSpcr;                                                 // @var global - SPI control of codec
+uint8_t _spiSpsr;                                                 // @var global - SPI status of codec
+#endif
+
+char _marqueeText[SSD1306_MARQUEE_CHARS + 1];                     // @var global - scrolled text
+uint8_t _marqueePage = 0;                                         // @var global - scrolled page
+uint8_t _marqueeDirection = 0;                                    // @var global - scroll direction
+uint8_t _marqueeInterval = 0;                                     // @var global - scroll interval
+uint8_t _marqueeActive = 0;                                       // @var global - hardware scroll active
+
+// @struct Run-length decoder of PROGMEM stream
+struct SSD1306_Rle {
+  const uint8_t * data;                                           // next code or literal
+  uint8_t count;                                                  // bytes left in run
+  uint8_t repeat;                                                 // run of repeated byte
+  uint8_t byte;                                                   // repeated byte
+};
+
+#if defined(SSD1306_FRAMEBUFFER)
+uint8_t _fb[SSD1306_FB_PAGES][RAM_X_END];                         // @var global - framebuffer
+uint8_t _fbDirtyStart[SSD1306_FB_PAGES];                          // @var global - first dirty column of page
+uint8_t _fbDirtyEnd[SSD1306_FB_PAGES];                            // @var global - last dirty column of page
+#endif
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+#if defined(SSD1306_SPI)
+/**
+ * @desc    SSD1306 SPI acquire - yield to codec, save SPI settings of codec,
+ *          set display settings & select display
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void SSD1306_Spi_Acquire (void)
+{
+  if (_yield) {
+    _yield ();                                                    // e.g. feed codec till DREQ low
+  }
+  _spiSpcr = SPI_SPCR;                                            // save settings of bus
+  _spiSpsr = SPI_SPSR;
+  SPI_SPCR = SSD1306_SPI_SETTINGS | (1 << SPE);                   // display settings
+  (SSD1306_SPI_2X == 1) ? (SPI_SPSR |= (1 << SPI2X)) : (SPI_SPSR &= ~(1 << SPI2X));
+  SSD1306_PORT_CS &= ~(1 << SSD1306_CS);                          // clear CS
+  _spiCount = 0;
+}
+
+/**
+ * @desc    SSD1306 SPI release - deselect display, restore SPI settings of codec
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void SSD1306_Spi_Release (void)
+{
+  SSD1306_PORT_CS |= (1 << SSD1306_CS);                           // set CS
+  SPI_SPCR = _spiSpcr;                                            // restore settings of bus
+  SPI_SPSR = _spiSpsr;
+}
+
+/**
+ * @desc    SSD1306 SPI send byte - bus is released & taken again after burst,
+ *          display keeps RAM pointer and D/C pin level while deselected
+ *
+ * @param   uint8_t byte
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_Spi_Send (uint8_t byte)
+{
+  if (_spiCount >= SSD1306_SPI_BURST) {
+    SSD1306_Spi_Release ();                                       // codec window
+    SSD1306_Spi_Acquire ();
+  }
+  SPI_Transfer (byte);
+  _spiCount++;
+
+  return SSD1306_SUCCESS;                                         // success
+}
+#endif
+
+/**
+ * @desc    SSD1306 Send byte - SPI, blocking or queued TWI
+ *
+ * @param   uint8_t byte
+ *
+ * @return  uint8_t
+ */
+static inline uint8_t SSD1306_Send_Byte (uint8_t byte)
+{
+#if defined(SSD1306_SPI)
+  return SSD1306_Spi_Send (byte);
+#elif defined(TWI_QUEUE)
+  return TWI_Queue_Byte (byte);
+#else
+  return TWI_MT_Send_Data (byte);
+#endif
+}
+
+/**
+ * @desc    SSD1306 Send byte n-times
+ *
+ * @param   uint8_t byte
+ * @param   uint16_t n-times
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_Send_Fill (uint8_t byte, uint16_t n)
+{
+#if defined(TWI_QUEUE) && !defined(SSD1306_SPI)
+  return TWI_Queue_Fill (byte, n);                                // one segment, no copy
+#else
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+
+  while (n--) {
+    status = SSD1306_Send_Byte (byte);                            // send data
+    if (SSD1306_SUCCESS != status) {                              // check status
+      return status;                                              // error
+    }
+  }
+  return SSD1306_SUCCESS;                                         // success
+#endif
+}
+
+#if defined(SSD1306_FRAMEBUFFER)
+/**
+ * @desc    SSD1306 Send bytes from RAM
+ *
+ * @param   const uint8_t * data - must stay valid till sent in queued mode
+ * @param   uint16_t n bytes
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_Send_Ram (const uint8_t * data, uint16_t n)
+{
+#if defined(TWI_QUEUE) && !defined(SSD1306_SPI)
+  return TWI_Queue_Data (TWI_SEG_RAM, data, n);                   // one segment, no copy
+#else
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+
+  while (n--) {
+    status = SSD1306_Send_Byte (*data++);                         // send data
+    if (SSD1306_SUCCESS != status) {                              // check status
+      return status;                                              // error
+    }
+  }
+  return SSD1306_SUCCESS;                                         // success
+#endif
+}
+#endif
+
+/**
+ * @desc    SSD1306 Send bytes from PROGMEM
+ *
+ * @param   const uint8_t * data in PROGMEM
+ * @param   uint16_t n bytes
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_Send_Pgm (const uint8_t * data, uint16_t n)
+{
+#if defined(TWI_QUEUE) && !defined(SSD1306_SPI)
+  return TWI_Queue_Data (TWI_SEG_PGM, data, n);                   // one segment, no copy
+#else
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+
+  while (n--) {
+    status = SSD1306_Send_Byte (pgm_read_byte (data++));          // send data
+    if (SSD1306_SUCCESS != status) {                              // check status
+      return status;                                              // error
+    }
+  }
+  return SSD1306_SUCCESS;                                         // success
+#endif
+}
+
+/**
+ * @desc    SSD1306 Send control byte - in SPI mode D/C pin is set instead,
+ *          D/C bit 6 of control byte: 0 = command, 1 = data
+ *
+ * @param   uint8_t control SSD1306_COMMAND, SSD1306_COMMAND_STREAM, SSD1306_DATA_STREAM
+ *
+ * @return  uint8_t
+ */
+static inline uint8_t SSD1306_Send_Control (uint8_t control)
+{
+#if defined(SSD1306_SPI)
+  if (control & 0x40) {
+    SSD1306_PORT_DC |= (1 << SSD1306_DC);                         // data
+  } else {
+    SSD1306_PORT_DC &= ~(1 << SSD1306_DC);                        // command
+  }
+  return SSD1306_SUCCESS;
+#else
+  return SSD1306_Send_Byte (control);
+#endif
+}
+
+/**
+ * @desc    SSD1306 Send stop - SPI release, blocking or queued TWI
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static inline void SSD1306_Send_Stop (void)
+{
+#if defined(SSD1306_SPI)
+  SSD1306_Spi_Release ();
+#elif defined(TWI_QUEUE)
+  TWI_Queue_Stop ();
+#else
+  TWI_Stop ();
+#endif
+}
+
+/**
+ * @desc    SSD1306 Check if page is held in framebuffer
+ *
+ * @param   uint8_t page
+ *
+ * @return  uint8_t
+ */
+static inline uint8_t SSD1306_IsCached (uint8_t page)
+{
+#if defined(SSD1306_FRAMEBUFFER)
+  return (page >= SSD1306_FB_START_PAGE) && (page <= SSD1306_FB_END_PAGE);
+#else
+  (void) page;
+  return 0;
+#endif
+}
+
+/**
+ * @desc    SSD1306 Send window commands as command stream - without START and STOP,
+ *          stream of commands can not be followed by data in the same transaction
+ *
+ * @param   uint8_t column -> 0 ... 127
+ * @param   uint8_t column -> 0 ... 127
+ * @param   uint8_t page -> 0 ... 7
+ * @param   uint8_t page -> 0 ... 7
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_Send_Window (uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2)
+{
+  uint8_t window[] = {SSD1306_SET_COLUMN_ADDR, x1, x2, SSD1306_SET_PAGE_ADDR, y1, y2};
+
+  // COLUMN 0x21 & PAGE 0x22
+  // -------------------------------------------------------------------------------------
+  return SSD1306_Send_Commands (window, sizeof(window));
+}
+
+/**
+ * @desc    SSD1306 Begin of data - [window transaction], TWI START, SLAW & data stream
+ *          control byte, nothing if actual page is held in framebuffer
+ *
+ * @param   uint8_t window - set window from actual position before data
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_DataBegin (uint8_t window)
+{
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+
+  if (SSD1306_IsCached (_indexPage)) {
+    return SSD1306_SUCCESS;                                       // drawn into RAM
+  }
+  // COLUMN & PAGE
+  // -------------------------------------------------------------------------------------
+  if (window) {
+    status = SSD1306_SetWindow (_indexCol, END_COLUMN_ADDR, _indexPage, END_PAGE_ADDR);
+    if (SSD1306_SUCCESS != status) {                              // check status
+      return status;                                              // error
+    }
+  }
+  // TWI START & SLAW
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_StartAndSLAW (SSD1306_ADDR);              // start & SLAW
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+  // TWI control byte data stream
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_Control (SSD1306_DATA_STREAM);            // send data 0x40
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+
+  return SSD1306_SUCCESS;                                         // success
+}
+
+/**
+ * @desc    SSD1306 Send data byte - into framebuffer or display, update column
+ *
+ * @param   uint8_t byte
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_DataSend (uint8_t byte)
+{
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+
+#if defined(SSD1306_FRAMEBUFFER)
+  uint8_t page = _indexPage - SSD1306_FB_START_PAGE;              // framebuffer page
+
+  if (SSD1306_IsCached (_indexPage)) {
+    _fb[page][_indexCol] = byte;                                  // store into RAM
+    if (_fbDirtyStart[page] == SSD1306_FB_CLEAN) {                // first change on page?
+      _fbDirtyStart[page] = _indexCol;                            // open dirty span
+      _fbDirtyEnd[page] = _indexCol;
+    } else if (_indexCol < _fbDirtyStart[page]) {                 // extend span left
+      _fbDirtyStart[page] = _indexCol;
+    } else if (_indexCol > _fbDirtyEnd[page]) {                   // extend span right
+      _fbDirtyEnd[page] = _indexCol;
+    }
+    _indexCol++;                                                  // update global col
+    return SSD1306_SUCCESS;                                       // success
+  }
+#endif
+  status = SSD1306_Send_Byte (byte);                              // send data col
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+  _indexCol++;                                                    // update global col
+
+  return SSD1306_SUCCESS;                                         // success
+}
+
+/**
+ * @desc    SSD1306 End of data - TWI STOP, nothing if actual page is held in framebuffer
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void SSD1306_DataEnd (void)
+{
+  if (!SSD1306_IsCached (_indexPage)) {
+    SSD1306_Send_Stop ();                                         // TWI STOP
+  }
+}
+
+/**
+ * @desc    SSD1306 Begin page of span - first page opens window x1 ... x2, y1 ... y2
+ *          and data stream, display wraps data to next page of window. Window across
+ *          framebuffer border is opened page by page.
+ *
+ * @param   uint8_t column -> 0 ... 127
+ * @param   uint8_t column -> 0 ... 127
+ * @param   uint8_t page -> 0 ... 7
+ * @param   uint8_t page -> 0 ... 7
+ * @param   uint8_t page of span to be sent
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_SpanBegin (uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, uint8_t page)
+{
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+  uint8_t split = SSD1306_IsCached (y1) != SSD1306_IsCached (y2);
+
+  if ((page == y1) || split) {
+    status = SSD1306_SetWindow (x1, x2, page, split ? page : y2);
+    if (SSD1306_SUCCESS != status) {                              // check status
+      return status;                                              // error
+    }
+    status = SSD1306_DataBegin (0);
+    if (SSD1306_SUCCESS != status) {                              // check status
+      return status;                                              // error
+    }
+  }
+  _indexCol = x1;                                                 // framebuffer position
+  _indexPage = page;
+
+  return SSD1306_SUCCESS;                                         // success
+}
+
+/**
+ * @desc    SSD1306 End page of span - TWI STOP after last page
+ *
+ * @param   uint8_t page -> 0 ... 7
+ * @param   uint8_t page -> 0 ... 7
+ * @param   uint8_t page of span sent
+ *
+ * @return  void
+ */
+static void SSD1306_SpanEnd (uint8_t y1, uint8_t y2, uint8_t page)
+{
+  if ((page == y2) || (SSD1306_IsCached (y1) != SSD1306_IsCached (y2))) {
+    SSD1306_DataEnd ();                                           // TWI STOP
+  }
+}
+
+/**
+ * @desc    SSD1306 Next byte of run-length code
+ *            0x00 ... 0x7F - (n + 1) literal bytes follow
+ *            0x80 ... 0xFF - next byte repeated (n - 0x80 + 3) times
+ *
+ * @param   struct SSD1306_Rle *
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_RleNext (struct SSD1306_Rle * rle)
+{
+  uint8_t code;
+
+  if (rle->count == 0) {
+    code = pgm_read_byte (rle->data++);
+    rle->repeat = code & 0x80;
+    if (rle->repeat) {
+      rle->count = code - 0x80 + 3;                               // repeated byte
+      rle->byte = pgm_read_byte (rle->data++);
+    } else {
+      rle->count = code + 1;                                      // literal bytes
+    }
+  }
+  rle->count--;
+
+  return rle->repeat ? rle->byte : pgm_read_byte (rle->data++);
+}
+
+/**
+ * @desc    SSD1306 Character width in columns including empty column
+ *
+ * @param   enum font
+ *
+ * @return  uint8_t
+ */
+static inline uint8_t SSD1306_CharWidth (enum E_Font font)
+{
+  return ((font & 0x0f) == BOLD) ? (CHARS_COLS_LENGTH << 1) + 1 : CHARS_COLS_LENGTH + 1;
+}
+
+/**
+ * @desc    SSD1306 Send glyph columns into opened data stream
+ *
+ * @param   char character
+ * @param   enum font
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_Send_Glyph (char ch, enum E_Font font)
+{
+  uint8_t byte;
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+  uint8_t i = 0;                                                  // counter
+  uint8_t mask = 0x00;
+
+  if (font & 0xf0) {                                              // underline?
+    mask = 0x80;                                                  // set underline mask
+  }
+
+  //  NORMAL / BOLD FONT
+  // -------------------------------------------------------------------------------------
+  while (i < CHARS_COLS_LENGTH) {
+    byte = pgm_read_byte (&FONTS[ch-32][i++]) | mask;
+    status = SSD1306_DataSend (byte);                             // send data 1st col
+    if (SSD1306_SUCCESS != status) {                              // check status
+      return status;                                              // error
+    }
+    if ((font & 0x0f) == BOLD) {                                  // bold font
+      status = SSD1306_DataSend (byte);                           // send data 2nd col
+      if (SSD1306_SUCCESS != status) {                            // check status
+        return status;                                            // error
+      }
+    }
+  }
+  //  send empty column to memory lcd
+  // -------------------------------------------------------------------------------------
+  return SSD1306_DataSend (mask);                                 // ONE empty column
+}
+
+/**
+ * @desc    SSD1306 Send one page of glyph from multi-page font into opened data stream,
+ *          run-length code is decoded straight from PROGMEM
+ *
+ * @param   const struct FONT_Packed * font (RAM copy of descriptor)
+ * @param   char character
+ * @param   uint8_t page of glyph
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_Send_GlyphPage (const struct FONT_Packed * font, char ch, uint8_t page)
+{
+  struct SSD1306_Rle rle;
+  const uint8_t * data;
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+  uint16_t skip = page * font->width;                             // bytes of previous pages
+  uint8_t n = font->width;                                        // bytes of this page
+
+  // character not in font -> empty columns
+  // -------------------------------------------------------------------------------------
+  if ((ch < font->first) || (ch > font->last)) {
+    while (n--) {
+      status = SSD1306_DataSend (CLEAR_COLOR);
+      if (SSD1306_SUCCESS != status) {                            // check status
+        return status;                                            // error
+      }
+    }
+    return SSD1306_SUCCESS;
+  }
+  // raw glyphs
+  // -------------------------------------------------------------------------------------
+  if (font->index == 0) {
+    data = font->data + (uint16_t) (ch - font->first) * font->width * font->pages + skip;
+    while (n--) {
+      status = SSD1306_DataSend (pgm_read_byte (data++));
+      if (SSD1306_SUCCESS != status) {                            // check status
+        return status;                                            // error
+      }
+    }
+    return SSD1306_SUCCESS;
+  }
+  // packed glyphs, previous pages are decoded & skipped
+  // -------------------------------------------------------------------------------------
+  rle.data = font->data + pgm_read_word (&font->index[ch - font->first]);
+  rle.count = 0;
+  while (skip--) {
+    SSD1306_RleNext (&rle);
+  }
+  while (n--) {
+    status = SSD1306_DataSend (SSD1306_RleNext (&rle));
+    if (SSD1306_SUCCESS != status) {                              // check status
+      return status;                                              // error
+    }
+  }
+
+  return SSD1306_SUCCESS;                                         // success
+}
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== FUNCTIONS =======================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @desc    SSD1306 Send Start and SLAW request
+ *
+ * @param   uint8_t
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_Send_StartAndSLAW (uint8_t address)
+{
+#if defined(SSD1306_SPI)
+  (void) address;
+  SSD1306_Spi_Acquire ();                                         // select display
+  return SSD1306_SUCCESS;                                         // success
+#elif defined(TWI_QUEUE)
+  TWI_Queue_Start (address);                                      // queued START & SLAW
+  return SSD1306_SUCCESS;                                         // success
+#else
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+
+  // TWI START
+  // -------------------------------------------------------------------------------------
+  status = TWI_MT_Start ();                                       // start
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+  // TWI SLAW
+  // -------------------------------------------------------------------------------------
+  status = TWI_MT_Send_SLAW (address);                            // start & SLAW
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+
+  return SSD1306_SUCCESS;                                         // success
+#endif
+}
+
+/**
+ * @desc    SSD1306 Send command
+ *
+ * @param   uint8_t command
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_Send_Command (uint8_t command)
+{
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+
+  // TWI send control byte
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_Control (SSD1306_COMMAND);                // send control byte
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+  // TWI send command
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_Byte (command);                           // send command
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+
+  return SSD1306_SUCCESS;                                         // success
+}
+
+/**
+ * @desc    SSD1306 Send command stream - control byte 0x00 once, then commands and
+ *          arguments from RAM, all bytes till STOP are commands
+ *
+ * @param   const uint8_t * list
+ * @param   uint8_t n bytes
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_Send_Commands (const uint8_t * list, uint8_t n)
+{
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+
+  // TWI send control byte
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_Control (SSD1306_COMMAND_STREAM);         // send control byte 0x00
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+  // TWI send commands, copied into queue (list may be on stack)
+  // -------------------------------------------------------------------------------------
+  while (n--) {
+    status = SSD1306_Send_Byte (*list++);                         // send command
+    if (SSD1306_SUCCESS != status) {                              // check status
+      return status;                                              // error
+    }
+  }
+
+  return SSD1306_SUCCESS;                                         // success
+}
+
+/**
+ * @desc    SSD1306 Send command stream - control byte 0x00 once, then commands and
+ *          arguments from PROGMEM, all bytes till STOP are commands
+ *
+ * @param   const uint8_t * list in PROGMEM
+ * @param   uint8_t n bytes
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_Send_Commands_P (const uint8_t * list, uint8_t n)
+{
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+
+  // TWI send control byte
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_Control (SSD1306_COMMAND_STREAM);         // send control byte 0x00
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+  // TWI send commands
+  // -------------------------------------------------------------------------------------
+  return SSD1306_Send_Pgm (list, n);
+}
+
+/**
+ * @desc    SSD1306 Init
+ *
+ * @param   uint8_t address
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_Init (uint8_t address)
+{
+  uint8_t reset = SSD1306_RESET;
+  uint8_t status = INIT_STATUS;                                   // init status
+
+#if defined(SSD1306_SPI)
+  // SPI: pins, bus settings of codec are kept & hardware reset
+  // -------------------------------------------------------------------------------------
+  SSD1306_DDR_CS |= (1 << SSD1306_CS);                            // CS as output
+  SSD1306_PORT_CS |= (1 << SSD1306_CS);                           // display not selected
+  SSD1306_DDR_DC |= (1 << SSD1306_DC);                            // D/C as output
+  SSD1306_DDR_RES |= (1 << SSD1306_RES);                          // RES as output
+  if (!(SPI_SPCR & (1 << SPE))) {                                 // bus not initialized?
+    SPI_Init (SSD1306_SPI_SETTINGS, SSD1306_SPI_2X);
+    SPI_Enable ();
+  }
+  SSD1306_PORT_RES &= ~(1 << SSD1306_RES);                        // reset min 3 us
+  _delay_us (10);
+  SSD1306_PORT_RES |= (1 << SSD1306_RES);
+  _delay_us (10);
+#else
+  // TWI: Init
+  // -------------------------------------------------------------------------------------
+  TWI_Init ();
+#endif
+
+  // SW RESET
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_StartAndSLAW (address);
+  if (SSD1306_SUCCESS != status) {
+    return status;
+  }
+  status = SSD1306_Send_Commands (&reset, 1);
+  if (SSD1306_SUCCESS != status) {
+    return status;
+  }
+  SSD1306_Send_Stop ();
+  status = SSD1306_Sync ();                                       // reset sent
+  if (SSD1306_SUCCESS != status) {
+    return status;
+  }
+  _delay_ms (1);
+
+  // Commands & Arguments in one stream
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_StartAndSLAW (address);
+  if (SSD1306_SUCCESS != status) {
+    return status;
+  }
+  status = SSD1306_Send_Commands_P (INIT_SSD1306, sizeof(INIT_SSD1306));
+  if (SSD1306_SUCCESS != status) {
+    return status;
+  }
+  // TWI: Stop
+  // -------------------------------------------------------------------------------------
+  SSD1306_Send_Stop ();
+
+#if defined(SSD1306_FRAMEBUFFER)
+  // Framebuffer without changes
+  // -------------------------------------------------------------------------------------
+  memset (_fbDirtyStart, SSD1306_FB_CLEAN, sizeof(_fbDirtyStart));
+#endif
+
+  return SSD1306_SUCCESS;                                         // success
+}
+
+/**
+ * @desc    SSD1306 Normal colors
+ *
+ * @param   void
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_NormalScreen (void)
+{
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+
+  // TWI START & SLAW
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_StartAndSLAW (SSD1306_ADDR);              // start & SLAW
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+  // TWI send command
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_Command (SSD1306_DIS_NORMAL);             // command 0xA6
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+  // TWI STOP
+  // -------------------------------------------------------------------------------------
+  SSD1306_Send_Stop ();
+
+  return SSD1306_SUCCESS;                                         // success
+}
+
+/**
+ * @desc    SSD1306 Inverse colors
+ *
+ * @param   void
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_InverseScreen (void)
+{
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+
+  // TWI START & SLAW
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_StartAndSLAW (SSD1306_ADDR);              // start & SLAW
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+  // TWI send command
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_Command (SSD1306_DIS_INVERSE);            // command 0xA7
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+  // TWI STOP
+  // -------------------------------------------------------------------------------------
+  SSD1306_Send_Stop ();
+
+  return SSD1306_SUCCESS;                                         // success
+}
+
+/**
+ * @desc    SSD1306 Clear screen
+ *
+ * @param   void
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_ClearScreen (void)
+{
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+  
+  // TWI START & SLAW
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_StartAndSLAW (SSD1306_ADDR);              // start & SLAW
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+  // COLUMN & PAGE
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_Window (0, END_COLUMN_ADDR, 0, END_PAGE_ADDR);
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+  SSD1306_Send_Stop ();
+  _indexCol = 0;                                                  // update column index
+  _indexPage = 0;                                                 // update page index
+  // TWI START & SLAW
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_StartAndSLAW (SSD1306_ADDR);              // start & SLAW
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+  // TWI control byte data stream
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_Control (SSD1306_DATA_STREAM);            // send data 0x40
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+  //  send clear byte to memory lcd
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_Fill (CLEAR_COLOR, CACHE_SIZE_MEM);       // send data 0x00
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+  // TWI STOP
+  // -------------------------------------------------------------------------------------
+  SSD1306_Send_Stop ();
+
+#if defined(SSD1306_FRAMEBUFFER)
+  //  clear framebuffer, display and RAM are equal
+  // -------------------------------------------------------------------------------------
+  memset (_fb, CLEAR_COLOR, sizeof(_fb));
+  memset (_fbDirtyStart, SSD1306_FB_CLEAN, sizeof(_fbDirtyStart));
+#endif
+
+  return SSD1306_SUCCESS;                                         // success
+}
+
+/**
+ * @desc    SSD1306 Set window
+ *
+ * @param   uint8_t column -> 0 ... 127
+ * @param   uint8_t column -> 0 ... 127
+ * @param   uint8_t page -> 0 ... 3 or 7
+ * @param   uint8_t page -> 0 ... 3 or 7
+ *
+ * @return  void
+ */
+uint8_t SSD1306_SetWindow (uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2)
+{
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+
+  _indexCol = x1;                                                 // update column index
+  _indexPage = y1;                                                // update page index
+
+  // page held in framebuffer, position is used at flush
+  // -------------------------------------------------------------------------------------
+  if (SSD1306_IsCached (y1)) {
+    return SSD1306_SUCCESS;                                       // success
+  }
+  // TWI START & SLAW
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_StartAndSLAW (SSD1306_ADDR);              // start & SLAW
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+  // COLUMN & PAGE
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_Window (x1, x2, y1, y2);
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+  // TWI STOP
+  // -------------------------------------------------------------------------------------
+  SSD1306_Send_Stop ();
+
+  return SSD1306_SUCCESS;                                         // success
+}
+
 /**
- * @desc    SSD1306 Send Start and SLAW request
+ * @desc    SSD1306 Set position
  *
- * @param   uint8_t
+ * @param   uint8_t column -> 0 ... 127
+ * @param   uint8_t page -> 0 ... 7
+ *
+ * @return  void
+ */
+uint8_t SSD1306_SetPosition (uint8_t x, uint8_t y)
+{
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+  uint8_t x_end = END_COLUMN_ADDR;
+  uint8_t y_end = END_PAGE_ADDR;
+ 
+  status = SSD1306_SetWindow (x, x_end, y, y_end);                // end COLUMN
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+
+  return SSD1306_SUCCESS;                                         // success
+}
+
+/**
+ * @desc    SSD1306 Update text poisition - this ensure that character will not be divided
+ *          at the end of row, the whole character will be depicted on the new row
+ *
+ * @param   uint8_t column
+ * @param   uint8_t page
  *
  * @return  uint8_t
  */
-uint8_t SSD1306_Send_StartAndSLAW (uint8_t address)
+uint8_t SSD1306_UpdatePosition (uint8_t x, uint8_t p)
 {
   uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
 
-  // TWI START
+  // check position
   // -------------------------------------------------------------------------------------
-  status = TWI_MT_Start ();                                       // start
+  if (x > END_COLUMN_ADDR) {
+    // last page not reached
+    // -----------------------------------------------------------------------------------
+    if (p < END_PAGE_ADDR) {
+      _indexCol = 0;                                              // update column
+      _indexPage = _indexPage + 1;                                // update page
+      status = SSD1306_SetPosition (_indexCol, _indexPage);       // update position
+      if (SSD1306_SUCCESS != status) {                            // check status
+        return status;                                            // error
+      }
+    }
+    // last page reached
+    // -----------------------------------------------------------------------------------
+    if (p >= END_PAGE_ADDR) {
+      return SSD1306_ERROR;                                       // return out of range
+    }
+  }
+
+  return SSD1306_SUCCESS;                                         // success
+}
+
+/**
+ * @desc    SSD1306 Draw character
+ *
+ * @param   char character
+ * @param   enum font 
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_DrawChar (char ch, enum E_Font font)
+{
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+  uint8_t next_x = _indexCol + SSD1306_CharWidth (font) - 1;      // next column
+  uint8_t next_p = _indexPage;                                    // next page
+
+  // UPDATE / CHECK TEXT POSITION
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_UpdatePosition (next_x, next_p);
   if (SSD1306_SUCCESS != status) {                                // check status
     return status;                                                // error
   }
-  // TWI SLAW
+
+  // TWI START & SLAW & data stream / framebuffer
   // -------------------------------------------------------------------------------------
-  status = TWI_MT_Send_SLAW (address);                            // start & SLAW
+  status = SSD1306_DataBegin (0);
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+  // Glyph
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_Glyph (ch, font);
   if (SSD1306_SUCCESS != status) {                                // check status
     return status;                                                // error
   }
+  // TWI STOP
+  // -------------------------------------------------------------------------------------
+  SSD1306_DataEnd ();
 
   return SSD1306_SUCCESS;                                         // success
 }
 
 /**
- * @desc    SSD1306 Send command
+ * @desc    SSD1306 Draw String
  *
- * @param   uint8_t command
+ * @param   char * string
  *
  * @return  uint8_t
  */
-uint8_t SSD1306_Send_Command (uint8_t command)
+uint8_t SSD1306_DrawString (char *str, enum E_Font font)
+{
+  return SSD1306_DrawStringTo (str, strlen (str), font);
+}
+
+/**
+ * @desc    SSD1306 Draw String - all characters of line are streamed in one TWI transaction,
+ *          the transaction of next line starts with window of new position
+ *
+ * @param   char * string
+ * @param   uint16_t
+ * @param   E_Font
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_DrawStringTo (char *str, uint16_t n, enum E_Font font)
 {
   uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+  uint8_t width = SSD1306_CharWidth (font);                       // columns of character
+  uint16_t i = 0;                                                 // char counter
 
-  // TWI send control byte
+  // TWI START & SLAW & data stream / framebuffer
   // -------------------------------------------------------------------------------------
-  status = TWI_MT_Send_Data (SSD1306_COMMAND);                    // send control byte
+  status = SSD1306_DataBegin (0);
   if (SSD1306_SUCCESS != status) {                                // check status
     return status;                                                // error
   }
-  // TWI send command
+
+  // send characters of string
+  // -------------------------------------------------------------------------------------
+  while (i < n) {
+    // character not fit to the end of row
+    // -----------------------------------------------------------------------------------
+    if ((_indexCol + width - 1) > END_COLUMN_ADDR) {
+      SSD1306_DataEnd ();                                         // TWI STOP
+      if (_indexPage >= END_PAGE_ADDR) {                          // last page reached
+        return SSD1306_ERROR;                                     // return out of range
+      }
+      _indexCol = 0;                                              // update column
+      _indexPage = _indexPage + 1;                                // update page
+      status = SSD1306_DataBegin (1);                             // new window & data
+      if (SSD1306_SUCCESS != status) {                            // check status
+        return status;                                            // error
+      }
+    }
+    // Glyph
+    // -----------------------------------------------------------------------------------
+    status = SSD1306_Send_Glyph (str[i++], font);                 // send char
+    if (SSD1306_SUCCESS != status) {                              // check status
+      return status;                                              // error
+    }
+  }
+  // TWI STOP
+  // -------------------------------------------------------------------------------------
+  SSD1306_DataEnd ();
+
+  return SSD1306_SUCCESS;                                         // success
+}
+
+/**
+ * @desc    SSD1306 Draw label - columns pre-rendered at build time (tools/labelgen.py)
+ *          are streamed from PROGMEM in one transaction, in queued mode as one segment
+ *
+ * @param   const uint8_t * label in PROGMEM - {width, columns}
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_DrawLabel (const uint8_t *label)
+{
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+  uint8_t width = pgm_read_byte (label++);                        // columns of label
+  uint8_t i;
+
+  // check position
+  // -------------------------------------------------------------------------------------
+  if ((_indexCol + width) > RAM_X_END) {
+    return SSD1306_ERROR;                                         // return out of range
+  }
+  // TWI START & SLAW & data stream / framebuffer
   // -------------------------------------------------------------------------------------
-  status = TWI_MT_Send_Data (command);                            // send command
+  status = SSD1306_DataBegin (0);
   if (SSD1306_SUCCESS != status) {                                // check status
     return status;                                                // error
   }
+  // columns
+  // -------------------------------------------------------------------------------------
+  if (SSD1306_IsCached (_indexPage)) {
+    for (i = 0; i < width; i++) {
+      status = SSD1306_DataSend (pgm_read_byte (label++));        // into framebuffer
+      if (SSD1306_SUCCESS != status) {                            // check status
+        return status;                                            // error
+      }
+    }
+  } else {
+    status = SSD1306_Send_Pgm (label, width);                     // straight to display
+    if (SSD1306_SUCCESS != status) {                              // check status
+      return status;                                              // error
+    }
+    _indexCol += width;                                           // update global col
+  }
+  // TWI STOP
+  // -------------------------------------------------------------------------------------
+  SSD1306_DataEnd ();
 
   return SSD1306_SUCCESS;                                         // success
 }
 
 /**
- * @desc    SSD1306 Init
+ * @desc    SSD1306 Draw string by multi-page font from actual position (top left),
+ *          all page rows of string are sent in one transaction with window of string
  *
- * @param   uint8_t address
+ * @param   char * string
+ * @param   const struct FONT_Packed * - font in PROGMEM
  *
  * @return  uint8_t
  */
-uint8_t SSD1306_Init (uint8_t address)
+uint8_t SSD1306_DrawStringBig (char *str, const struct FONT_Packed *font_P)
 {
-  const uint8_t * list = INIT_SSD1306;
-  uint8_t status = INIT_STATUS;                                   // init status
-  uint8_t arguments;
-  uint8_t commands = pgm_read_byte (list++);
+  struct FONT_Packed font;
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+  uint8_t x = _indexCol;                                          // top left column
+  uint8_t y = _indexPage;                                         // top left page
+  uint8_t page;
+  uint8_t n = 0;
+  uint8_t i;
 
-  // TWI: Init
+  memcpy_P (&font, font_P, sizeof(font));                         // font descriptor
+
+  // check position
   // -------------------------------------------------------------------------------------
-  TWI_Init ();
+  if ((y + font.pages - 1) > END_PAGE_ADDR) {
+    return SSD1306_ERROR;                                         // return out of range
+  }
+  while ((str[n] != '\0') && ((x + (n + 1) * font.width) <= RAM_X_END)) {
+    n++;                                                          // characters in row
+  }
+
+  if (n == 0) {
+    return SSD1306_SUCCESS;                                       // nothing to draw
+  }
 
-  // TWI: start & SLAW
+  // page rows of string
   // -------------------------------------------------------------------------------------
-  status = SSD1306_Send_StartAndSLAW (address);
-  if (SSD1306_SUCCESS != status) {
-    return status;
+  for (page = y; page < y + font.pages; page++) {
+    status = SSD1306_SpanBegin (x, x + n * font.width - 1, y, y + font.pages - 1, page);
+    if (SSD1306_SUCCESS != status) {                              // check status
+      return status;                                              // error
+    }
+    for (i = 0; i < n; i++) {
+      status = SSD1306_Send_GlyphPage (&font, str[i], page - y);
+      if (SSD1306_SUCCESS != status) {                            // check status
+        return status;                                            // error
+      }
+    }
+    SSD1306_SpanEnd (y, y + font.pages - 1, page);
   }
+  _indexCol = x + n * font.width;                                 // next character
+  _indexPage = y;
 
-  // SW RESET
-  // -----------------------------------------------------------------------------------
-  status = SSD1306_Send_Command (SSD1306_RESET);
-  if (SSD1306_SUCCESS != status) {
-    return status;
+  return SSD1306_SUCCESS;                                         // success
+}
+
+/**
+ * @desc    SSD1306 Draw bitmap - run-length packed bitmap from PROGMEM is decoded
+ *          while streamed, all pages are sent in one transaction with window of bitmap.
+ *          If y is not page aligned, every page is composed from two pages of bitmap
+ *          by two decoders; bits of partial pages out of bitmap are cleared.
+ *
+ * @param   uint8_t column -> 0 ... 127
+ * @param   uint8_t row in pixels -> 0 ... 63
+ * @param   const uint8_t * bitmap - {width, height, packed pages}
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_DrawBitmap (uint8_t x, uint8_t y, const uint8_t *bitmap)
+{
+  struct SSD1306_Rle lower = {bitmap + 2, 0, 0, 0};               // page of bitmap
+  struct SSD1306_Rle upper = {bitmap + 2, 0, 0, 0};               // previous page of bitmap
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+  uint8_t width = pgm_read_byte (&bitmap[0]);
+  uint8_t height = pgm_read_byte (&bitmap[1]);
+  uint8_t pages = (height + 7) >> 3;                              // pages of bitmap
+  uint8_t shift = y & 0x07;                                       // bits below page start
+  uint8_t y1 = y >> 3;                                            // first page of display
+  uint8_t y2 = (y + height - 1) >> 3;                             // last page of display
+  uint8_t page;
+  uint8_t byte;
+  uint8_t i;
+
+  // check position
+  // -------------------------------------------------------------------------------------
+  if ((width == 0) || (height == 0) || ((x + width) > RAM_X_END) || ((y + height) > MAX_Y)) {
+    return SSD1306_ERROR;                                         // return out of range
   }
-  _delay_ms (1);
 
-  // Commands & Arguments
+  // pages of display
   // -------------------------------------------------------------------------------------
-  while (commands--) {
-    // Command
-    // -----------------------------------------------------------------------------------
-    status = SSD1306_Send_Command (pgm_read_byte(list++));
-    if (SSD1306_SUCCESS != status) {
-      return status;
+  for (page = y1; page <= y2; page++) {
+    status = SSD1306_SpanBegin (x, x + width - 1, y1, y2, page);
+    if (SSD1306_SUCCESS != status) {                              // check status
+      return status;                                              // error
     }
-    // Arguments
-    // -----------------------------------------------------------------------------------
-    arguments = pgm_read_byte (list++);
-    while (arguments--) {
-      status = SSD1306_Send_Command (pgm_read_byte(list++));  // argument
-      if (SSD1306_SUCCESS != status) {
-        return status;
+    for (i = 0; i < width; i++) {
+      byte = CLEAR_COLOR;
+      if ((page - y1) < pages) {
+        byte = SSD1306_RleNext (&lower) << shift;                 // top part from page
+      }
+      if (shift && (page > y1)) {
+        byte |= SSD1306_RleNext (&upper) >> (8 - shift);          // rest of previous page
+      }
+      status = SSD1306_DataSend (byte);
+      if (SSD1306_SUCCESS != status) {                            // check status
+        return status;                                            // error
+      }
+    }
+    SSD1306_SpanEnd (y1, y2, page);
+  }
+
+  return SSD1306_SUCCESS;                                         // success
+}
+
+/**
+ * @desc    SSD1306 Draw block from RAM - pages of block ordered as written to display,
+ *          page by page, all pages are sent in one transaction with window of block
+ *
+ * @param   uint8_t column -> 0 ... 127
+ * @param   uint8_t page -> 0 ... 7
+ * @param   uint8_t width in columns
+ * @param   uint8_t height in pages
+ * @param   const uint8_t * block - width * pages bytes
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_DrawBlock (uint8_t x, uint8_t page, uint8_t width, uint8_t pages, const uint8_t *block)
+{
+  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+  uint8_t y2 = page + pages - 1;                                  // last page of display
+  uint8_t p;
+  uint8_t i;
+
+  // check position
+  // -------------------------------------------------------------------------------------
+  if ((width == 0) || (pages == 0) || ((x + width) > RAM_X_END) || (y2 > END_PAGE_ADDR)) {
+    return SSD1306_ERROR;                                         // return out of range
+  }
+
+  // pages of display
+  // -------------------------------------------------------------------------------------
+  for (p = page; p <= y2; p++) {
+    status = SSD1306_SpanBegin (x, x + width - 1, page, y2, p);
+    if (SSD1306_SUCCESS != status) {                              // check status
+      return status;                                              // error
+    }
+    for (i = 0; i < width; i++) {
+      status = SSD1306_DataSend (*block++);
+      if (SSD1306_SUCCESS != status) {                            // check status
+        return status;                                            // error
       }
     }
+    SSD1306_SpanEnd (page, y2, p);
+  }
+
+  return SSD1306_SUCCESS;                                         // success
+}
+
+/**
+ * @desc    SSD1306 Field init - nothing is sent, first draw sends all characters
+ *
+ * @param   struct SSD1306_Field *
+ * @param   uint8_t column -> 0 ... 127
+ * @param   uint8_t page -> 0 ... 7
+ * @param   uint8_t length -> 1 ... SSD1306_FIELD_LEN
+ * @param   enum E_Font
+ * @param   const struct FONT_Packed * - multi-page font or 0 for font 5x8
+ *
+ * @return  uint8_t - SSD1306_ERROR if field is out of display, field left empty
+ */
+uint8_t SSD1306_FieldInit (struct SSD1306_Field *field, uint8_t x, uint8_t page, uint8_t length, enum E_Font font, const struct FONT_Packed *big)
+{
+  uint8_t width = SSD1306_CharWidth (font);                       // columns of character
+  uint8_t pages = 1;                                              // pages of character
+
+  if (big) {
+    width = pgm_read_byte (&big->width);
+    pages = pgm_read_byte (&big->pages);
   }
-  // TWI: Stop
+  field->x = x;
+  field->page = page;
+  field->length = 0;                                              // nothing drawn if out of range
+  field->font = font;
+  field->big = big;
+  memset (field->text, '\0', sizeof(field->text));                // content unknown
+
+  // check position, same as draw block
   // -------------------------------------------------------------------------------------
-  TWI_Stop ();
+  length = (length > SSD1306_FIELD_LEN) ? SSD1306_FIELD_LEN : length;
+  if ((length == 0) || (((uint16_t) x + (uint16_t) length * width) > RAM_X_END) ||
+      (((uint16_t) page + pages - 1) > END_PAGE_ADDR)) {
+    return SSD1306_ERROR;                                         // return out of range
+  }
+  field->length = length;
 
   return SSD1306_SUCCESS;                                         // success
 }
 
 /**
- * @desc    SSD1306 Normal colors
+ * @desc    SSD1306 Field draw - every run of changed characters is sent in one TWI
+ *          transaction with the narrowest window: columns of run, pages of font
  *
- * @param   void
+ * @param   struct SSD1306_Field *
+ * @param   char * string - shorter string is padded by spaces
  *
  * @return  uint8_t
  */
-uint8_t SSD1306_NormalScreen (void)
+uint8_t SSD1306_FieldDraw (struct SSD1306_Field *field, char *str)
 {
+  struct FONT_Packed font;
+  char text[SSD1306_FIELD_LEN];
   uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+  uint8_t width = SSD1306_CharWidth (field->font);                // columns of character
+  uint8_t pages = 1;                                              // pages of character
+  uint8_t first;
+  uint8_t last = 0;
+  uint8_t page;
+  uint8_t x;
+  uint8_t i;
 
-  // TWI START & SLAW
-  // -------------------------------------------------------------------------------------
-  status = SSD1306_Send_StartAndSLAW (SSD1306_ADDR);              // start & SLAW
-  if (SSD1306_SUCCESS != status) {                                // check status
-    return status;                                                // error
+  if (field->big) {
+    memcpy_P (&font, field->big, sizeof(font));                   // font descriptor
+    width = font.width;
+    pages = font.pages;
   }
-  // TWI send command
+  // new content padded by spaces
   // -------------------------------------------------------------------------------------
-  status = SSD1306_Send_Command (SSD1306_DIS_NORMAL);             // command 0xA6
-  if (SSD1306_SUCCESS != status) {                                // check status
-    return status;                                                // error
+  for (i = 0; i < field->length; i++) {
+    text[i] = (*str != '\0') ? *str++ : ' ';
   }
-  // TWI STOP
+  // runs of changed characters
   // -------------------------------------------------------------------------------------
-  TWI_Stop ();
+  for (first = 0; first < field->length; first = last + 1) {
+    if (text[first] == field->text[first]) {
+      last = first;                                               // unchanged, skip
+      continue;
+    }
+    last = first;
+    while ((last + 1 < field->length) && (text[last + 1] != field->text[last + 1])) {
+      last++;                                                     // extend run
+    }
+    x = field->x + first * width;
+    for (page = field->page; page < field->page + pages; page++) {
+      // window of run & data stream
+      // ---------------------------------------------------------------------------------
+      status = SSD1306_SpanBegin (x, x + (last - first + 1) * width - 1,
+                                  field->page, field->page + pages - 1, page);
+      if (SSD1306_SUCCESS != status) {                            // check status
+        return status;                                            // error
+      }
+      // glyphs of run
+      // ---------------------------------------------------------------------------------
+      for (i = first; i <= last; i++) {
+        if (field->big) {
+          status = SSD1306_Send_GlyphPage (&font, text[i], page - field->page);
+        } else {
+          status = SSD1306_Send_Glyph (text[i], field->font);
+        }
+        if (SSD1306_SUCCESS != status) {                          // check status
+          return status;                                          // error
+        }
+      }
+      SSD1306_SpanEnd (field->page, field->page + pages - 1, page);
+    }
+    memcpy (&field->text[first], &text[first], last - first + 1); // characters on display
+  }
 
   return SSD1306_SUCCESS;                                         // success
 }
 
 /**
- * @desc    SSD1306 Inverse colors
+ * @desc    SSD1306 Field number - right aligned decimal value
  *
- * @param   void
+ * @param   struct SSD1306_Field *
+ * @param   uint16_t
  *
  * @return  uint8_t
  */
-uint8_t SSD1306_InverseScreen (void)
+uint8_t SSD1306_FieldNumber (struct SSD1306_Field *field, uint16_t value)
 {
-  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+  char text[SSD1306_FIELD_LEN + 1];
+  uint8_t i = field->length;
 
-  // TWI START & SLAW
-  // -------------------------------------------------------------------------------------
-  status = SSD1306_Send_StartAndSLAW (SSD1306_ADDR);              // start & SLAW
-  if (SSD1306_SUCCESS != status) {                                // check status
-    return status;                                                // error
-  }
-  // TWI send command
-  // -------------------------------------------------------------------------------------
-  status = SSD1306_Send_Command (SSD1306_DIS_INVERSE);            // command 0xA7
-  if (SSD1306_SUCCESS != status) {                                // check status
-    return status;                                                // error
+  text[i] = '\0';
+  do {
+    text[--i] = '0' + (value % 10);                               // digits from right
+    value /= 10;
+  } while (value && i);
+  while (i) {
+    text[--i] = ' ';                                              // leading spaces
   }
-  // TWI STOP
-  // -------------------------------------------------------------------------------------
-  TWI_Stop ();
 
-  return SSD1306_SUCCESS;                                         // success
+  return SSD1306_FieldDraw (field, text);
 }
 
 /**
- * @desc    SSD1306 Clear screen
+ * @desc    SSD1306 Field time - seconds as mm:ss, max 99:59
  *
- * @param   void
+ * @param   struct SSD1306_Field *
+ * @param   uint16_t seconds
  *
  * @return  uint8_t
  */
-uint8_t SSD1306_ClearScreen (void)
+uint8_t SSD1306_FieldTime (struct SSD1306_Field *field, uint16_t seconds)
 {
-  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
-  
-  // TWI START & SLAW
-  // -------------------------------------------------------------------------------------
-  status = SSD1306_Send_StartAndSLAW (SSD1306_ADDR);              // start & SLAW
-  if (SSD1306_SUCCESS != status) {                                // check status
-    return status;                                                // error
-  }
-  // COLUMN
-  // -------------------------------------------------------------------------------------
-  status = SSD1306_Send_Command (SSD1306_SET_COLUMN_ADDR);        // 0x21
-  if (SSD1306_SUCCESS != status) {                                // check status
-    return status;                                                // error
-  }
-  status = SSD1306_Send_Command (0);                              // start COLUMN
-  if (SSD1306_SUCCESS != status) {                                // check status
-    return status;                                                // error
-  }
-  status = SSD1306_Send_Command (END_COLUMN_ADDR);                // end COLUMN
-  if (SSD1306_SUCCESS != status) {                                // check status
-    return status;                                                // error
-  }
-  _indexCol = 0;                                                  // update column index
-  // PAGE
-  // -------------------------------------------------------------------------------------
-  status = SSD1306_Send_Command (SSD1306_SET_PAGE_ADDR);          // 0x22
-  if (SSD1306_SUCCESS != status) {                                // check status
-    return status;                                                // error
-  }
-  status = SSD1306_Send_Command (0);                              // start PAGE
-  if (SSD1306_SUCCESS != status) {                                // check status
-    return status;                                                // error
-  }
-  status = SSD1306_Send_Command (END_PAGE_ADDR);                  // end PAGE
-  if (SSD1306_SUCCESS != status) {                                // check status
-    return status;                                                // error
-  }
-  _indexPage = 0;                                                 // update column index  
-  // TWI control byte data stream
-  // -------------------------------------------------------------------------------------
-  status = TWI_MT_Send_Data (SSD1306_DATA_STREAM);                // send data 0x40
-  if (SSD1306_SUCCESS != status) {                                // check status
-    return status;                                                // error
-  }
-  //  send clear byte to memory lcd
-  // -------------------------------------------------------------------------------------
-  for (uint16_t i=0; i<CACHE_SIZE_MEM; i++) {
-    status = TWI_MT_Send_Data (CLEAR_COLOR);                      // send data 0x00
-    if (SSD1306_SUCCESS != status) {                              // check status
-      return status;                                              // error
-    }
+  char text[] = "00:00";
+  uint8_t minutes;
+
+  if (seconds > 5999) {
+    seconds = 5999;                                               // 99:59
   }
-  // TWI STOP
-  // -------------------------------------------------------------------------------------
-  TWI_Stop ();
+  minutes = seconds / 60;
+  seconds = seconds % 60;
+  text[0] += minutes / 10;
+  text[1] += minutes % 10;
+  text[3] += seconds / 10;
+  text[4] += seconds % 10;
 
-  return SSD1306_SUCCESS;                                         // success
+  return SSD1306_FieldDraw (field, text);
 }
 
 /**
- * @desc    SSD1306 Set position
+ * @desc    SSD1306 Marquee - render text into one page and scroll it by hardware,
+ *          text is sent again only if changed
  *
- * @param   uint8_t column -> 0 ... 127
- * @param   uint8_t column -> 0 ... 127
- * @param   uint8_t page -> 0 ... 3 or 7
- * @param   uint8_t page -> 0 ... 3 or 7
+ * @param   uint8_t page -> 0 ... 7
+ * @param   char * string - clipped to one page (21 chars)
+ * @param   uint8_t direction SSD1306_SCROLL_HOR_LEFT / SSD1306_SCROLL_HOR_RIGHT
+ * @param   uint8_t interval SSD1306_SCROLL_x_FRAMES
  *
- * @return  void
+ * @return  uint8_t
  */
-uint8_t SSD1306_SetWindow (uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2)
+uint8_t SSD1306_MarqueeStart (uint8_t page, char *str, uint8_t direction, uint8_t interval)
 {
+  uint8_t scroll[] = {direction, 0x00, page, interval, page, 0x00, 0xFF, SSD1306_ACTIVE_SCROLL};
   uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
+  uint8_t width = SSD1306_CharWidth (NORMAL);
+  uint8_t i = 0;
 
-  // TWI START & SLAW
+  // same text & settings already scrolled, only visible chars compared
   // -------------------------------------------------------------------------------------
-  status = SSD1306_Send_StartAndSLAW (SSD1306_ADDR);              // start & SLAW
-  if (SSD1306_SUCCESS != status) {                                // check status
-    return status;                                                // error
+  if (_marqueeActive && (page == _marqueePage) && (direction == _marqueeDirection) &&
+      (interval == _marqueeInterval) && !strncmp (str, _marqueeText, SSD1306_MARQUEE_CHARS)) {
+    return SSD1306_SUCCESS;                                       // nothing to send
   }
-  // COLUMN
+  // RAM must not be written while scrolling
   // -------------------------------------------------------------------------------------
-  status = SSD1306_Send_Command (SSD1306_SET_COLUMN_ADDR);        // 0x21
+  status = SSD1306_MarqueeStop ();
   if (SSD1306_SUCCESS != status) {                                // check status
     return status;                                                // error
   }
-  status = SSD1306_Send_Command (x1);                             // start COLUMN
+  // text & empty columns of whole page in one transaction
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_SetPosition (0, page);
   if (SSD1306_SUCCESS != status) {                                // check status
     return status;                                                // error
   }
-  status = SSD1306_Send_Command (x2);                             // end COLUMN
+  status = SSD1306_DataBegin (0);
   if (SSD1306_SUCCESS != status) {                                // check status
     return status;                                                // error
   }
-  _indexCol = x1;                                                 // update column index
-  // PAGE
-  // -------------------------------------------------------------------------------------
-  status = SSD1306_Send_Command (SSD1306_SET_PAGE_ADDR);          // 0x22
-  if (SSD1306_SUCCESS != status) {                                // check status
-    return status;                                                // error
+  i = 0;
+  while ((str[i] != '\0') && ((_indexCol + width) <= RAM_X_END)) {
+    status = SSD1306_Send_Glyph (str[i++], NORMAL);               // send char
+    if (SSD1306_SUCCESS != status) {                              // check status
+      return status;                                              // error
+    }
+  }
+  while (_indexCol <= END_COLUMN_ADDR) {
+    status = SSD1306_DataSend (CLEAR_COLOR);                      // clear rest of page
+    if (SSD1306_SUCCESS != status) {                              // check status
+      return status;                                              // error
+    }
   }
-  status = SSD1306_Send_Command (y1);                             // start PAGE
+  SSD1306_DataEnd ();
+  status = SSD1306_Flush ();                                      // page held in RAM
   if (SSD1306_SUCCESS != status) {                                // check status
     return status;                                                // error
   }
-  status = SSD1306_Send_Command (y2);                             // end PAGE
+  // horizontal scroll setup & activate
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_StartAndSLAW (SSD1306_ADDR);              // start & SLAW
   if (SSD1306_SUCCESS != status) {                                // check status
     return status;                                                // error
   }
-  _indexPage = y1;                                                // update column index
-
-  // TWI STOP
-  // -------------------------------------------------------------------------------------
-  TWI_Stop ();
-
-  return SSD1306_SUCCESS;                                         // success
-}
-
-/**
- * @desc    SSD1306 Set position
- *
- * @param   uint8_t column -> 0 ... 127
- * @param   uint8_t page -> 0 ... 7
- *
- * @return  void
- */
-uint8_t SSD1306_SetPosition (uint8_t x, uint8_t y)
-{
-  uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
-  uint8_t x_end = END_COLUMN_ADDR;
-  uint8_t y_end = END_PAGE_ADDR;
- 
-  status = SSD1306_SetWindow (x, x_end, y, y_end);                // end COLUMN
+  status = SSD1306_Send_Commands (scroll, sizeof(scroll));        // commands & arguments
   if (SSD1306_SUCCESS != status) {                                // check status
     return status;                                                // error
   }
+  SSD1306_Send_Stop ();
+
+  strncpy (_marqueeText, str, SSD1306_MARQUEE_CHARS);
+  _marqueeText[SSD1306_MARQUEE_CHARS] = '\0';
+  _marqueePage = page;
+  _marqueeDirection = direction;
+  _marqueeInterval = interval;
+  _marqueeActive = 1;
 
   return SSD1306_SUCCESS;                                         // success
 }
 
 /**
- * @desc    SSD1306 Update text poisition - this ensure that character will not be divided
- *          at the end of row, the whole character will be depicted on the new row
+ * @desc    SSD1306 Marquee stop - deactivate hardware scroll, scrolled page has to be
+ *          rewritten afterwards (datasheet SSD1306, command 2Eh)
  *
- * @param   uint8_t column
- * @param   uint8_t page
+ * @param   void
  *
  * @return  uint8_t
  */
-uint8_t SSD1306_UpdatePosition (uint8_t x, uint8_t p)
+uint8_t SSD1306_MarqueeStop (void)
 {
   uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
 
-  // check position
+  if (!_marqueeActive) {
+    return SSD1306_SUCCESS;                                       // not scrolling
+  }
+  // TWI START & SLAW
   // -------------------------------------------------------------------------------------
-  if (x > END_COLUMN_ADDR) {
-    // last page not reached
-    // -----------------------------------------------------------------------------------
-    if (p < END_PAGE_ADDR) {
-      _indexCol = 0;                                              // update column
-      _indexPage = _indexPage + 1;                                // update page
-      status = SSD1306_SetPosition (_indexCol, _indexPage);       // update position
-      if (SSD1306_SUCCESS != status) {                            // check status
-        return status;                                            // error
-      }
-    }
-    // last page reached
-    // -----------------------------------------------------------------------------------
-    if (p >= END_PAGE_ADDR) {
-      return SSD1306_ERROR;                                       // return out of range
-    }
+  status = SSD1306_Send_StartAndSLAW (SSD1306_ADDR);              // start & SLAW
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
+  }
+  status = SSD1306_Send_Command (SSD1306_DEACT_SCROLL);           // command 0x2E
+  if (SSD1306_SUCCESS != status) {                                // check status
+    return status;                                                // error
   }
+  // TWI STOP
+  // -------------------------------------------------------------------------------------
+  SSD1306_Send_Stop ();
+
+  _marqueeActive = 0;                                             // page must be rendered again
 
   return SSD1306_SUCCESS;                                         // success
 }
 
 /**
- * @desc    SSD1306 Draw character
+ * @desc    SSD1306 Flush framebuffer - every dirty column span of page is sent
+ *          by window command stream and data stream transaction
  *
- * @param   char character
- * @param   enum font 
+ * @param   void
  *
  * @return  uint8_t
  */
-uint8_t SSD1306_DrawChar (char ch, enum E_Font font)
+uint8_t SSD1306_Flush (void)
 {
-  uint8_t byte;
+#if defined(SSD1306_FRAMEBUFFER)
   uint8_t status = INIT_STATUS;                                   // TWI init status 0xFF
-  uint8_t i = 0;                                                  // counter
-  uint8_t next_x;
-  uint8_t next_p;
-  uint8_t mask = 0x00;
-
-  //  NORMAL FONT
-  // -------------------------------------------------------------------------------------
-  if ((font & 0x0f) == NORMAL) { 
-
-    if (font & 0xf0) {                                            // underline?
-      mask = 0x80;                                                // set underline mask
-    }
-
-    next_x = _indexCol + CHARS_COLS_LENGTH;                       // next column
-    next_p = _indexPage;                                          // next page
+  uint8_t page;
+  uint8_t col;
 
-    // UPDATE / CHECK TEXT POSITION
-    // -----------------------------------------------------------------------------------
-    status = SSD1306_UpdatePosition (next_x, next_p);
-    if (SSD1306_SUCCESS != status) {                              // check status
-      return status;                                              // error
+  for (page = 0; page < SSD1306_FB_PAGES; page++) {
+    if (_fbDirtyStart[page] == SSD1306_FB_CLEAN) {                // page without changes
+      continue;
     }
-
     // TWI START & SLAW
     // -----------------------------------------------------------------------------------
     status = SSD1306_Send_StartAndSLAW (SSD1306_ADDR);            // start & SLAW
     if (SSD1306_SUCCESS != status) {                              // check status
       return status;                                              // error
     }
-    // TWI control byte data stream
-    // -----------------------------------------------------------------------------------
-    status = TWI_MT_Send_Data (SSD1306_DATA_STREAM);              // send data 0x40
-    if (SSD1306_SUCCESS != status) {                              // check status
-      return status;                                              // error
-    }
-
-    while (i < CHARS_COLS_LENGTH) {
-      byte = pgm_read_byte (&FONTS[ch-32][i++]);
-      status = TWI_MT_Send_Data (byte | mask);                    // send data col
-      if (SSD1306_SUCCESS != status) {                            // check status
-        return status;                                            // error
-      }
-      _indexCol++;                                                // update global col
-    }
-  //  BOLD FONT
-  // -------------------------------------------------------------------------------------
-  } else if ((font & 0x0f) == BOLD) {
-
-    if (font & 0xf0) {                                            // underline?
-      mask = 0x80;                                                // set underline mask
-    }
-
-    next_x = _indexCol + (CHARS_COLS_LENGTH << 1);                // next column
-    next_p = _indexPage;                                          // next page
-
-    // UPDATE / CHECK TEXT POSITION
+    // COLUMN & PAGE of dirty span
     // -----------------------------------------------------------------------------------
-    status = SSD1306_UpdatePosition (next_x, next_p);
+    status = SSD1306_Send_Window (_fbDirtyStart[page], _fbDirtyEnd[page],
+                                  page + SSD1306_FB_START_PAGE, page + SSD1306_FB_START_PAGE);
     if (SSD1306_SUCCESS != status) {                              // check status
       return status;                                              // error
     }
-
+    SSD1306_Send_Stop ();
     // TWI START & SLAW
     // -----------------------------------------------------------------------------------
     status = SSD1306_Send_StartAndSLAW (SSD1306_ADDR);            // start & SLAW
@@ -496,77 +1641,60 @@ uint8_t SSD1306_DrawChar (char ch, enum E_Font font)
     }
     // TWI control byte data stream
     // -----------------------------------------------------------------------------------
-    status = TWI_MT_Send_Data (SSD1306_DATA_STREAM);              // send data 0x40
+    status = SSD1306_Send_Control (SSD1306_DATA_STREAM);          // send data 0x40
     if (SSD1306_SUCCESS != status) {                              // check status
       return status;                                              // error
     }
-
-    while (i < CHARS_COLS_LENGTH) {
-      byte = pgm_read_byte (&FONTS[ch-32][i++]);
-      status = TWI_MT_Send_Data (byte | mask);                    // send data 1st col
-      if (SSD1306_SUCCESS != status) {                            // check status
-        return status;                                            // error
-      }
-      status = TWI_MT_Send_Data (byte | mask);                    // send data 2nd col
-      if (SSD1306_SUCCESS != status) {                            // check status
-        return status;                                            // error
-      }
-      _indexCol = _indexCol + 2;                                  // update global col
+    // dirty span
+    // -----------------------------------------------------------------------------------
+    col = _fbDirtyStart[page];
+    status = SSD1306_Send_Ram (&_fb[page][col], _fbDirtyEnd[page] - col + 1);
+    if (SSD1306_SUCCESS != status) {                              // check status
+      return status;                                              // error
     }
-  } 
-  //  send empty column to memory lcd
-  // -------------------------------------------------------------------------------------
-  status = TWI_MT_Send_Data (mask);                               // ONE empty column
-  if (SSD1306_SUCCESS != status) {                                // check status
-    return status;                                                // error
+    // TWI STOP
+    // -----------------------------------------------------------------------------------
+    SSD1306_Send_Stop ();
+    _fbDirtyStart[page] = SSD1306_FB_CLEAN;                       // page is clean
   }
-  _indexCol++;                                                    // update global col
 
-  // TWI STOP
+  // restore window of display for pages drawn directly
   // -------------------------------------------------------------------------------------
-  TWI_Stop ();
+  if (!SSD1306_IsCached (_indexPage) && (_indexCol <= END_COLUMN_ADDR)) {
+    return SSD1306_SetPosition (_indexCol, _indexPage);
+  }
+#endif
 
   return SSD1306_SUCCESS;                                         // success
 }
 
 /**
- * @desc    SSD1306 Draw String
+ * @desc    SSD1306 Sync - wait till queued transactions are sent
  *
- * @param   char * string
+ * @param   void
  *
- * @return  uint8_t
+ * @return  uint8_t - first TWI error since last sync
  */
-uint8_t SSD1306_DrawString (char *str, enum E_Font font)
+uint8_t SSD1306_Sync (void)
 {
-  uint8_t i = 0;                                                  // char counter
-
-  // send characters of string
-  // -------------------------------------------------------------------------------------
-  while (str[i] != '\0') {
-    SSD1306_DrawChar (str[i++], font);                            // send char
-  }
-
-  return SSD1306_SUCCESS;                                         // success
+#if defined(TWI_QUEUE) && !defined(SSD1306_SPI)
+  return TWI_Flush ();
+#else
+  return SSD1306_SUCCESS;                                         // blocking, already sent
+#endif
 }
 
 /**
- * @desc    SSD1306 Draw String
+ * @desc    SSD1306 Set yield function - called before display takes the SPI bus,
+ *          at start of transaction and after every SSD1306_SPI_BURST bytes. Codec
+ *          feeder should send data while DREQ is high, then display burst fits into
+ *          the time codec decodes its buffer.
  *
- * @param   char * string
- * @param   uint16_t
- * @param   E_Font
+ * @param   void (*) (void) - 0 = none
  *
- * @return  uint8_t
+ * @return  void
  */
-uint8_t SSD1306_DrawStringTo (char *str, uint16_t n, enum E_Font font)
+void SSD1306_SetYield (void (*yield) (void))
 {
-  uint8_t i = 0;                                                  // char counter
-
-  // send characters of string
-  // -------------------------------------------------------------------------------------
-  while (i < n) {
-    SSD1306_DrawChar (str[i++], font);                            // send char
-  }
-
-  return SSD1306_SUCCESS;                                         // success
+  _yield = yield;
 }
\ No newline at end of file
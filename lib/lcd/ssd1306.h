@@ -12,7 +12,7 @@
  * @version     3.0
  * @tested      AVR Atmega328p
  *
- * @depend      font.h, twi.h
+ * @depend      font.h, font_large.h, twi.h, spi.h
  * -------------------------------------------------------------------------------------+
  * @descr       Version 1.0 -> applicable for 1 display
  *              Version 2.0 -> rebuild to 'cacheMemLcd' array
@@ -27,7 +27,9 @@
   // includes
   #include <util/delay.h>
   #include "font.h"
+  #include "font_large.h"
   #include "twi.h"
+  #include "../spi.h"
 
   // Success / Error
   // ------------------------------------------------------------------------------------
@@ -38,6 +40,26 @@
   // ------------------------------------------------------------------------------------
   #define SSD1306_ADDR              0x3C
 
+  // SPI 4-wire transport definition
+  // ------------------------------------------------------------------------------------
+  // SSD1306_SPI               - display on SPI bus shared with VS1053 instead of TWI,
+  //                             D/C pin replaces control bytes, CS frames bursts
+  // SSD1306_SPI_BURST         - max bytes sent while display holds the bus,
+  //                             then the bus is released & yield function called
+//#define SSD1306_SPI
+  #define SSD1306_DDR_CS            DDRB
+  #define SSD1306_PORT_CS           PORTB
+  #define SSD1306_CS                1
+  #define SSD1306_DDR_DC            DDRD
+  #define SSD1306_PORT_DC           PORTD
+  #define SSD1306_DC                5
+  #define SSD1306_DDR_RES           DDRD
+  #define SSD1306_PORT_RES          PORTD
+  #define SSD1306_RES               4
+  #define SSD1306_SPI_SETTINGS      (SPI_MASTER | SPI_MODE_0 | SPI_MSB_FIRST | SPI_FOSC_DIV_4)
+  #define SSD1306_SPI_2X            1     // f = fclk/4 * 2 = 4 MHz, display max 10 MHz
+  #define SSD1306_SPI_BURST         64
+
   // Command definition
   // ------------------------------------------------------------------------------------
   #define SSD1306_COMMAND           0x80  // Continuation bit=1, D/C=0; 1000 0000
@@ -82,6 +104,18 @@
   #define SSD1306_NOP               0xE3  // No operation
   #define SSD1306_RESET             0xE4  // Maybe SW RESET, @source https://github.com/SmingHub/Sming/issues/501
 
+  // Scroll step interval in frames
+  // ------------------------------------------------------------------------------------
+  #define SSD1306_SCROLL_2_FRAMES   0x07
+  #define SSD1306_SCROLL_3_FRAMES   0x04
+  #define SSD1306_SCROLL_4_FRAMES   0x05
+  #define SSD1306_SCROLL_5_FRAMES   0x00
+  #define SSD1306_SCROLL_25_FRAMES  0x06
+  #define SSD1306_SCROLL_64_FRAMES  0x01
+  #define SSD1306_SCROLL_128_FRAMES 0x02
+  #define SSD1306_SCROLL_256_FRAMES 0x03
+  #define SSD1306_MARQUEE_CHARS     21    // chars of normal font on one page
+
   // Clear Color
   // ------------------------------------------------------------------------------------
   #define CLEAR_COLOR               0x00
@@ -104,6 +138,22 @@
   #define MAX_X                     END_COLUMN_ADDR
   #define MAX_Y                     (END_PAGE_ADDR + 1) * 8
 
+  // Framebuffer definition
+  // ------------------------------------------------------------------------------------
+  // SSD1306_FRAMEBUFFER       - draw into RAM, send to display by SSD1306_Flush ()
+  // SSD1306_FB_START_PAGE     - first page held in RAM
+  // SSD1306_FB_END_PAGE       - last page held in RAM, pages out of range are drawn directly
+  //                             0 ... 7 = 1 KB, 0 ... 3 = 512 B, 2 ... 2 = 128 B
+//#define SSD1306_FRAMEBUFFER
+  #ifndef SSD1306_FB_START_PAGE
+    #define SSD1306_FB_START_PAGE   START_PAGE_ADDR
+  #endif
+  #ifndef SSD1306_FB_END_PAGE
+    #define SSD1306_FB_END_PAGE     END_PAGE_ADDR
+  #endif
+  #define SSD1306_FB_PAGES          (SSD1306_FB_END_PAGE - SSD1306_FB_START_PAGE + 1)
+  #define SSD1306_FB_CLEAN          0xFF  // start column of page without changes
+
   // @enum
   enum E_Font {
     NORMAL = 0x00,
@@ -111,6 +161,20 @@
     UNDERLINE = 0x10
   };
 
+  // Numeric field definition
+  // ------------------------------------------------------------------------------------
+  #define SSD1306_FIELD_LEN         8     // max characters of field
+
+  // @struct Field - remembers drawn characters, only changed glyphs are sent again
+  struct SSD1306_Field {
+    uint8_t x;                            // column of first character
+    uint8_t page;                         // top page
+    uint8_t length;                       // characters of field
+    enum E_Font font;                     // font if big is 0
+    const struct FONT_Packed * big;       // multi-page font in PROGMEM or 0
+    char text[SSD1306_FIELD_LEN];         // characters on display, '\0' = unknown
+  };
+
   /**
    * @brief   SSD1306 Send Start and SLAW request
    *
@@ -129,6 +193,26 @@
    */
   uint8_t SSD1306_Send_Command (uint8_t);
 
+  /**
+   * @brief   SSD1306 Send command stream from RAM - control byte 0x00 & commands
+   *
+   * @param   const uint8_t *
+   * @param   uint8_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_Send_Commands (const uint8_t *, uint8_t);
+
+  /**
+   * @brief   SSD1306 Send command stream from PROGMEM - control byte 0x00 & commands
+   *
+   * @param   const uint8_t *
+   * @param   uint8_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_Send_Commands_P (const uint8_t *, uint8_t);
+
   /**
    * @brief   SSD1306 Init
    *
@@ -226,4 +310,144 @@
    */
   uint8_t SSD1306_DrawStringTo (char *, uint16_t, enum E_Font);
 
+  /**
+   * @brief   SSD1306 Draw label pre-rendered by tools/labelgen.py, no wrap
+   *
+   * @param   const uint8_t * label in PROGMEM - {width, columns}
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_DrawLabel (const uint8_t *);
+
+  /**
+   * @brief   SSD1306 Draw string by multi-page font from actual position (top left),
+   *          no wrap, characters out of row are not drawn,
+   *          window of display is left narrowed, set position before next text
+   *
+   * @param   char *
+   * @param   const struct FONT_Packed * - font in PROGMEM, FONT_8X16 / FONT_16X32
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_DrawStringBig (char *, const struct FONT_Packed *);
+
+  /**
+   * @brief   SSD1306 Draw bitmap packed by run-length code, see tools/bmpconv.py
+   *
+   * @param   uint8_t column -> 0 ... 127
+   * @param   uint8_t row in pixels -> 0 ... 63
+   * @param   const uint8_t * bitmap in PROGMEM - {width, height, packed pages}
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_DrawBitmap (uint8_t, uint8_t, const uint8_t *);
+
+  /**
+   * @brief   SSD1306 Draw block from RAM, pages of block ordered page by page
+   *
+   * @param   uint8_t column -> 0 ... 127
+   * @param   uint8_t page -> 0 ... 7
+   * @param   uint8_t width in columns
+   * @param   uint8_t height in pages
+   * @param   const uint8_t * block - width * pages bytes
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_DrawBlock (uint8_t, uint8_t, uint8_t, uint8_t, const uint8_t *);
+
+  /**
+   * @brief   SSD1306 Field init - nothing is sent, first draw sends all characters
+   *
+   * @param   struct SSD1306_Field *
+   * @param   uint8_t column -> 0 ... 127
+   * @param   uint8_t page -> 0 ... 7
+   * @param   uint8_t length -> 1 ... SSD1306_FIELD_LEN
+   * @param   enum E_Font
+   * @param   const struct FONT_Packed * - multi-page font or 0 for font 5x8
+   *
+   * @return  uint8_t - SSD1306_ERROR if field is out of display, field left empty
+   */
+  uint8_t SSD1306_FieldInit (struct SSD1306_Field *, uint8_t, uint8_t, uint8_t, enum E_Font, const struct FONT_Packed *);
+
+  /**
+   * @brief   SSD1306 Field draw - send only characters different from last draw,
+   *          window of display is left narrowed, set position before next text
+   *
+   * @param   struct SSD1306_Field *
+   * @param   char * string - shorter string is padded by spaces
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_FieldDraw (struct SSD1306_Field *, char *);
+
+  /**
+   * @brief   SSD1306 Field number - right aligned decimal value
+   *
+   * @param   struct SSD1306_Field *
+   * @param   uint16_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_FieldNumber (struct SSD1306_Field *, uint16_t);
+
+  /**
+   * @brief   SSD1306 Field time - seconds as mm:ss, max 99:59
+   *
+   * @param   struct SSD1306_Field *
+   * @param   uint16_t seconds
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_FieldTime (struct SSD1306_Field *, uint16_t);
+
+  /**
+   * @brief   SSD1306 Marquee - render text into one page and scroll it by hardware,
+   *          text is sent again only if changed
+   *
+   * @param   uint8_t page -> 0 ... 7
+   * @param   char * string - clipped to one page (21 chars)
+   * @param   uint8_t direction SSD1306_SCROLL_HOR_LEFT / SSD1306_SCROLL_HOR_RIGHT
+   * @param   uint8_t interval SSD1306_SCROLL_x_FRAMES
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_MarqueeStart (uint8_t, char *, uint8_t, uint8_t);
+
+  /**
+   * @brief   SSD1306 Marquee stop - deactivate hardware scroll
+   *
+   * @param   void
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_MarqueeStop (void);
+
+  /**
+   * @brief   SSD1306 Flush framebuffer - send dirty column spans of pages
+   *
+   * @param   void
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_Flush (void);
+
+  /**
+   * @brief   SSD1306 Set yield function - called before display takes the SPI bus,
+   *          e.g. to feed the codec while its DREQ is high (SSD1306_SPI)
+   *
+   * @param   void (*) (void) - 0 = none
+   *
+   * @return  void
+   */
+  void SSD1306_SetYield (void (*) (void));
+
+  /**
+   * @brief   SSD1306 Sync - wait till queued transactions are sent (TWI_QUEUE)
+   *
+   * @param   void
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_Sync (void);
+
 #endif
\ No newline at end of file
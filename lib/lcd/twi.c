@@ -17,8 +17,149 @@
  
 // include libraries
 #include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <util/atomic.h>
+#include <util/delay.h>
 #include "twi.h"
 
+// @const uint8_t - TWBR & prescaler of speed levels
+const uint8_t TWI_SPEEDS[TWI_SPEED_LEVELS][2] PROGMEM = {
+  { TWI_BIT_RATE, TWI_PRESCALER },                                // TWI_SCL_FREQ
+#if TWI_SCL_FREQ > 400000UL
+  { TWI_TWBR_CALC(400000UL, 0), 0 },                              // 400 kHz
+#else
+  { TWI_BIT_RATE, TWI_PRESCALER },                                // already slower
+#endif
+#if TWI_SCL_FREQ > 100000UL
+  { TWI_TWBR_CALC(100000UL, 0), 0 }                               // 100 kHz
+#else
+  { TWI_BIT_RATE, TWI_PRESCALER }                                 // already slower
+#endif
+};
+
+volatile uint8_t _twiSpeed = 0;                                   // @var global - speed level
+volatile uint8_t _twiTransactions = 0;                            // @var global - transactions in window
+volatile uint8_t _twiNacks = 0;                                   // @var global - NACKs in window
+
+#if defined(TWI_QUEUE)
+struct TWI_Segment _twiQueue[TWI_QUEUE_SIZE];                     // @var global - segments
+uint8_t _twiFifo[TWI_FIFO_SIZE];                                  // @var global - inline bytes
+volatile uint8_t _twiHead = 0;                                    // @var global - write segment
+volatile uint8_t _twiTail = 0;                                    // @var global - sent segment
+volatile uint8_t _twiFifoHead = 0;                                // @var global - write byte
+volatile uint8_t _twiFifoTail = 0;                                // @var global - sent byte
+volatile uint16_t _twiSent = 0;                                   // @var global - sent bytes of segment
+volatile uint8_t _twiState = TWI_IDLE;                            // @var global - queue state
+volatile uint8_t _twiError = 0;                                   // @var global - first error status
+volatile uint8_t _twiDrop = 0;                                    // @var global - drop failed transaction
+volatile uint8_t _twiProgress = 0;                                // @var global - interrupts counter
+uint8_t _twiStart = 0;                                            // @var global - START for next segment
+uint8_t _twiAddress = 0;                                          // @var global - address for next segment
+#endif
+
+/**
+ * @desc    TWI account transaction, step speed down if NACK rate rises
+ *
+ * @param   uint8_t nack
+ *
+ * @return  void
+ */
+static void TWI_Account (uint8_t nack)
+{
+  if (nack) {
+    _twiNacks++;                                                  // NACK in window
+    return;
+  }
+  if (++_twiTransactions < TWI_FALLBACK_WINDOW) {                 // transaction in window
+    return;
+  }
+  if ((_twiNacks >= TWI_FALLBACK_NACKS) && (_twiSpeed < (TWI_SPEED_LEVELS - 1))) {
+    _twiSpeed++;                                                  // lower speed
+    TWI_FREQ (pgm_read_byte (&TWI_SPEEDS[_twiSpeed][0]), pgm_read_byte (&TWI_SPEEDS[_twiSpeed][1]));
+  }
+  _twiTransactions = 0;                                           // new window
+  _twiNacks = 0;
+}
+
+/**
+ * @desc    TWI wait till TWINT flag is set, bounded by TWI_TIMEOUT_US
+ *
+ * @param   void
+ *
+ * @return  char - SUCCESS or TWI_NO_INFO after timeout & bus recovery
+ */
+static char TWI_Wait (void)
+{
+  uint16_t loops = TWI_TIMEOUT_LOOPS;
+
+  while (!(TWI_TWCR & (1 << TWINT))) {
+    if (--loops == 0) {
+      TWI_Recover ();                                             // stuck bus
+      return TWI_NO_INFO;                                         // timeout
+    }
+  }
+  return SUCCESS;
+}
+
+/**
+ * @desc    TWI error - release bus after failed step
+ *
+ * @param   uint8_t status
+ *
+ * @return  char - status, ERROR for bus error (0x00 would read as success)
+ */
+static char TWI_Error (uint8_t status)
+{
+  if (status == TWI_BUS_ERROR) {
+    TWI_Recover ();                                               // illegal START / STOP
+    return ERROR;
+  }
+  TWI_STOP ();                                                    // release bus
+  return status;
+}
+
+/**
+ * @desc    TWI recover - TWI off, up to 9 SCL clocks (100 kHz) till slave releases SDA,
+ *          START & STOP condition by hand, TWI on again. Pins are driven as open drain
+ *          by DDR, external pull-ups are expected.
+ *
+ * @param   void
+ *
+ * @return  char - SUCCESS if SDA is released
+ */
+char TWI_Recover (void)
+{
+  uint8_t i;
+
+  TWI_TWCR = 0;                                                   // TWI off, pins to port
+  TWI_PORT &= ~((1 << TWI_SCL) | (1 << TWI_SDA));                 // low when output
+  TWI_DDR &= ~((1 << TWI_SCL) | (1 << TWI_SDA));                  // release SCL & SDA
+  _delay_us (5);
+
+  // clock out byte of slave holding SDA low
+  // ----------------------------------------------
+  for (i = 0; i < TWI_RECOVER_CLOCKS; i++) {
+    if (TWI_PIN & (1 << TWI_SDA)) {
+      break;                                                      // SDA released
+    }
+    TWI_DDR |= (1 << TWI_SCL);                                    // SCL low
+    _delay_us (5);
+    TWI_DDR &= ~(1 << TWI_SCL);                                   // SCL high
+    _delay_us (5);
+  }
+  // START & STOP resets slave state machine
+  // ----------------------------------------------
+  TWI_DDR |= (1 << TWI_SDA);                                      // SDA low while SCL high
+  _delay_us (5);
+  TWI_DDR &= ~(1 << TWI_SDA);                                     // SDA high while SCL high
+  _delay_us (5);
+
+  TWI_TWCR = (1 << TWEN);                                         // TWI on
+
+  return (TWI_PIN & (1 << TWI_SDA)) ? SUCCESS : ERROR;
+}
+
 /**
  * @desc    TWI init - initialize frequency
  *
@@ -31,20 +172,34 @@ void TWI_Init (void)
   // +++++++++++++++++++++++++++++++++++++++++++++
   // Calculation fclk:
   //
-  // fclk = (fcpu)/(16+2*TWBR*4^Prescaler) m16
-  // fclk = (fcpu)/(16+2*TWBR*Prescaler) m328p
+  // fclk = (fcpu)/(16+2*TWBR*4^Prescaler)
   // --------------------------------------------- 
-  // Calculation TWBR:
+  // Calculation TWBR (compile time, twi.h):
   // 
   // TWBR = {(fcpu/fclk) - 16 } / (2*4^Prescaler)
   // +++++++++++++++++++++++++++++++++++++++++++++
-  // @param1 value of TWBR (m16) 
-  //  fclk = 400kHz; TWBR = 3
-  //  fclk = 100kHz; TWBR = 20
-  // @param1 value of TWBR (m328p)
-  //  fclk = 400kHz; TWBR = 2
-  // @param2 value of Prescaler = 1
-  TWI_FREQ (2, 1);
+  // fcpu = 8 MHz
+  //  fclk = 100kHz; TWBR = 32, Prescaler = 1
+  //  fclk = 400kHz; TWBR = 2,  Prescaler = 1
+  //  fclk = 500kHz; TWBR = 0,  Prescaler = 1 (TWI_SCL_MAX)
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {                            // shared with TWI interrupt
+    _twiSpeed = 0;
+    _twiTransactions = 0;
+    _twiNacks = 0;
+    TWI_FREQ (TWI_BIT_RATE, TWI_PRESCALER);
+  }
+}
+
+/**
+ * @desc    TWI get actual speed level
+ *
+ * @param   void
+ *
+ * @return  uint8_t
+ */
+uint8_t TWI_Speed (void)
+{
+  return _twiSpeed;
 }
 
 /**
@@ -63,12 +218,17 @@ char TWI_MT_Start (void)
   // request for bus
   TWI_START();
   // wait till flag set
-  TWI_WAIT_TILL_TWINT_IS_SET();
+  if (TWI_Wait () != SUCCESS) {
+    // timeout, bus recovered
+    return TWI_NO_INFO;
+  }
   // test if start or repeated start acknowledged
   if ((TWI_STATUS != TWI_START_ACK) && (TWI_STATUS != TWI_REP_START_ACK)) {
     // return status
-    return TWI_STATUS;
+    return TWI_Error (TWI_STATUS);
   }
+  // transaction for speed fallback
+  TWI_Account (0);
   // success
   return SUCCESS;
 }
@@ -88,12 +248,17 @@ char TWI_MT_Send_SLAW (char address)
   // enable
   TWI_ENABLE();
   // wait till flag set
-  TWI_WAIT_TILL_TWINT_IS_SET();
+  if (TWI_Wait () != SUCCESS) {
+    // timeout, bus recovered
+    return TWI_NO_INFO;
+  }
 
   // test if SLA with WRITE acknowledged
   if (TWI_STATUS != TWI_MT_SLAW_ACK) {
+    // NACK for speed fallback
+    TWI_Account (1);
     // return status
-    return TWI_STATUS;
+    return TWI_Error (TWI_STATUS);
   }
   // success
   return SUCCESS;
@@ -114,12 +279,17 @@ char TWI_MT_Send_Data (char data)
   // enable
   TWI_ENABLE();
   // wait till flag set
-  TWI_WAIT_TILL_TWINT_IS_SET();
+  if (TWI_Wait () != SUCCESS) {
+    // timeout, bus recovered
+    return TWI_NO_INFO;
+  }
 
   // test if data acknowledged
   if (TWI_STATUS != TWI_MT_DATA_ACK) {
+    // NACK for speed fallback
+    TWI_Account (1);
     // return status
-    return TWI_STATUS;
+    return TWI_Error (TWI_STATUS);
   }
   // success
   return SUCCESS;
@@ -140,12 +310,15 @@ char TWI_MR_Send_SLAR (char address)
   // enable
   TWI_ENABLE();
   // wait till flag set
-  TWI_WAIT_TILL_TWINT_IS_SET();
+  if (TWI_Wait () != SUCCESS) {
+    // timeout, bus recovered
+    return TWI_NO_INFO;
+  }
 
   // test if SLA with READ acknowledged
   if (TWI_STATUS != TWI_MR_SLAR_ACK) {
     // return status
-    return TWI_STATUS;
+    return TWI_Error (TWI_STATUS);
   }
   // success
   return SUCCESS;
@@ -164,6 +337,376 @@ void TWI_Stop (void)
   // -------------------------------------------------
   // send stop sequence
   TWI_STOP ();
-  // wait for TWINT flag is set
-//  TWI_WAIT_TILL_TWINT_IS_SET();
 }
+
+#if defined(TWI_QUEUE)
+
+/**
+ * @desc    TWI Queue release tail segment
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void TWI_Queue_Release (void)
+{
+  struct TWI_Segment * seg = &_twiQueue[_twiTail];
+
+  if ((seg->flags & TWI_SEG_SOURCE) == TWI_SEG_FIFO) {
+    _twiFifoTail += (uint8_t) (seg->length - _twiSent);           // skip unsent inline bytes
+  }
+  _twiTail = (_twiTail + 1) & (TWI_QUEUE_SIZE - 1);
+  _twiSent = 0;
+}
+
+/**
+ * @desc    TWI Queue watch - called in wait loops, if interrupt makes no progress
+ *          for TWI_TIMEOUT_US (approx.) queue is emptied & bus recovered
+ *
+ * @param   uint16_t * loops without progress
+ * @param   uint8_t * last seen progress
+ *
+ * @return  char - SUCCESS or TWI_NO_INFO if queue was reset
+ */
+static char TWI_Queue_Watch (uint16_t * loops, uint8_t * progress)
+{
+  if (*progress != _twiProgress) {
+    *progress = _twiProgress;                                     // interrupt alive
+    *loops = 0;
+    return SUCCESS;
+  }
+  if (++*loops < TWI_TIMEOUT_LOOPS) {
+    return SUCCESS;
+  }
+  // stuck -> drop everything queued
+  // ----------------------------------------------
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+    TWI_TWCR = 0;                                                 // no more interrupts
+    _twiHead = _twiTail = 0;
+    _twiFifoHead = _twiFifoTail = 0;
+    _twiSent = 0;
+    _twiDrop = 0;
+    _twiState = TWI_IDLE;
+    if (!_twiError) {
+      _twiError = TWI_NO_INFO;                                    // keep first error
+    }
+  }
+  TWI_Recover ();
+  *loops = 0;
+
+  return TWI_NO_INFO;
+}
+
+/**
+ * @desc    TWI Queue launch next transaction, called with interrupts disabled,
+ *          no bus recovery here - stuck bus is recovered by watch in main loop
+ *
+ * @param   uint8_t stop - failed transaction closed by STOP first (interrupt)
+ *
+ * @return  void
+ */
+static void TWI_Queue_Launch (uint8_t stop)
+{
+  uint16_t loops = 0;
+
+  // drop rest of failed transaction
+  // ----------------------------------------------
+  while (_twiDrop && (_twiHead != _twiTail)) {
+    if (_twiQueue[_twiTail].flags & TWI_SEG_STOP) {
+      _twiDrop = 0;
+    }
+    TWI_Queue_Release ();
+  }
+  if (_twiHead == _twiTail) {
+    if (stop) {
+      TWI_TWCR = (1 << TWEN) | (1 << TWINT) | (1 << TWSTO);
+    }
+    _twiState = TWI_IDLE;                                         // nothing to send
+    return;
+  }
+  _twiState = TWI_RUN;
+  // STOP followed by START, hardware waits for STOP itself
+  // ----------------------------------------------
+  if (stop) {
+    TWI_TWCR = (1 << TWEN) | (1 << TWINT) | (1 << TWSTO) | (1 << TWSTA) | (1 << TWIE);
+    return;
+  }
+  // START
+  // ----------------------------------------------
+  while (TWI_TWCR & (1 << TWSTO)) {                               // previous STOP on bus
+    if (++loops >= TWI_TIMEOUT_LOOPS) {
+      break;                                                      // STOP not executed, watch recovers
+    }
+  }
+  TWI_TWCR = (1 << TWEN) | (1 << TWINT) | (1 << TWSTA) | (1 << TWIE);
+}
+
+/**
+ * @desc    TWI Queue transmit next byte, called from interrupt
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void TWI_Queue_Next (void)
+{
+  struct TWI_Segment * seg;
+  uint8_t next;
+
+  while (1) {
+    seg = &_twiQueue[_twiTail];
+    // DATA
+    // ----------------------------------------------
+    if (_twiSent < seg->length) {
+      switch (seg->flags & TWI_SEG_SOURCE) {
+        case TWI_SEG_FIFO:
+          TWI_TWDR = _twiFifo[_twiFifoTail++ & (TWI_FIFO_SIZE - 1)];
+          break;
+        case TWI_SEG_RAM:
+          TWI_TWDR = seg->data[_twiSent];
+          break;
+        case TWI_SEG_PGM:
+          TWI_TWDR = pgm_read_byte (&seg->data[_twiSent]);
+          break;
+        default:
+          TWI_TWDR = seg->value;
+          break;
+      }
+      _twiSent++;
+      TWI_TWCR = (1 << TWEN) | (1 << TWINT) | (1 << TWIE);
+      return;
+    }
+    next = (_twiTail + 1) & (TWI_QUEUE_SIZE - 1);
+    // STOP
+    // ----------------------------------------------
+    if (seg->flags & TWI_SEG_STOP) {
+      TWI_Queue_Release ();
+      if (_twiHead != _twiTail) {                                 // STOP followed by START
+        TWI_TWCR = (1 << TWEN) | (1 << TWINT) | (1 << TWSTO) | (1 << TWSTA) | (1 << TWIE);
+      } else {
+        TWI_TWCR = (1 << TWEN) | (1 << TWINT) | (1 << TWSTO);
+        _twiState = TWI_IDLE;
+      }
+      return;
+    }
+    // transaction continues, next segment not queued yet
+    // ----------------------------------------------
+    if (next == _twiHead) {
+      TWI_TWCR = (1 << TWEN);                                     // TWINT stays set, SCL held low
+      _twiState = TWI_STALL;
+      return;
+    }
+    TWI_Queue_Release ();                                         // continue with next segment
+  }
+}
+
+/**
+ * @desc    TWI interrupt - master transmit state machine
+ *
+ * @param   TWI_vect
+ *
+ * @return  void
+ */
+ISR (TWI_vect)
+{
+  uint8_t status = TWI_STATUS;
+
+  _twiProgress++;                                                 // alive for watch
+
+  // START / repeated START -> SLA+W
+  // ----------------------------------------------
+  if ((status == TWI_START_ACK) || (status == TWI_REP_START_ACK)) {
+    TWI_Account (0);                                              // transaction for fallback
+    TWI_TWDR = (_twiQueue[_twiTail].address << 1);
+    TWI_TWCR = (1 << TWEN) | (1 << TWINT) | (1 << TWIE);
+  // SLA+W / DATA acknowledged -> DATA
+  // ----------------------------------------------
+  } else if ((status == TWI_MT_SLAW_ACK) || (status == TWI_MT_DATA_ACK)) {
+    TWI_Queue_Next ();
+  // NACK, arbitration lost, bus error -> STOP, drop transaction
+  // ----------------------------------------------
+  } else {
+    if (!_twiError) {
+      _twiError = status;                                         // keep first error
+    }
+    TWI_Account (1);                                              // NACK for fallback
+    _twiDrop = 1;
+    TWI_Queue_Launch (1);
+  }
+}
+
+/**
+ * @desc    TWI Queue kick - (re)start transmitting after new segment
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void TWI_Queue_Kick (void)
+{
+  if (_twiState == TWI_IDLE) {
+    TWI_Queue_Launch (0);                                         // new transaction
+  } else if (_twiState == TWI_STALL) {
+    _twiState = TWI_RUN;
+    TWI_TWCR = (1 << TWEN) | (1 << TWIE);                         // TWINT pending -> interrupt
+  }
+}
+
+/**
+ * @desc    TWI Queue wait for free segment and fill it
+ *
+ * @param   uint8_t flags
+ * @param   uint8_t value
+ * @param   const uint8_t * data
+ * @param   uint16_t length
+ *
+ * @return  char
+ */
+static char TWI_Queue_Push (uint8_t flags, uint8_t value, const uint8_t * data, uint16_t length)
+{
+  struct TWI_Segment * seg;
+  uint16_t loops = 0;
+  uint8_t progress = _twiProgress;
+
+  while (((_twiHead + 1) & (TWI_QUEUE_SIZE - 1)) == _twiTail) {   // wait for free segment
+    if (TWI_Queue_Watch (&loops, &progress) != SUCCESS) {
+      return TWI_NO_INFO;                                         // bus stuck, queue reset
+    }
+  }
+
+  seg = &_twiQueue[_twiHead];
+  seg->flags = flags | _twiStart;
+  seg->address = _twiAddress;
+  seg->value = value;
+  seg->data = data;
+  seg->length = length;
+  _twiStart = 0;
+
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+    _twiHead = (_twiHead + 1) & (TWI_QUEUE_SIZE - 1);             // publish segment
+    TWI_Queue_Kick ();
+  }
+  return SUCCESS;
+}
+
+/**
+ * @desc    TWI Queue Start - next segment begins with START & SLAW
+ *
+ * @param   uint8_t address
+ *
+ * @return  void
+ */
+void TWI_Queue_Start (uint8_t address)
+{
+  _twiStart = TWI_SEG_START;
+  _twiAddress = address;
+}
+
+/**
+ * @desc    TWI Queue data byte - appended to last inline segment if possible
+ *
+ * @param   uint8_t
+ *
+ * @return  char
+ */
+char TWI_Queue_Byte (uint8_t data)
+{
+  struct TWI_Segment * seg;
+  uint16_t loops = 0;
+  uint8_t progress = _twiProgress;
+  uint8_t last;
+
+  while ((uint8_t) (_twiFifoHead - _twiFifoTail) >= TWI_FIFO_SIZE) { // wait for free byte
+    if (TWI_Queue_Watch (&loops, &progress) != SUCCESS) {
+      return TWI_NO_INFO;                                         // bus stuck, queue reset
+    }
+  }
+  _twiFifo[_twiFifoHead & (TWI_FIFO_SIZE - 1)] = data;
+
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+    _twiFifoHead++;
+    last = (_twiHead - 1) & (TWI_QUEUE_SIZE - 1);
+    seg = &_twiQueue[last];
+    // extend open inline segment
+    // ----------------------------------------------
+    if (!_twiStart && (_twiHead != _twiTail) &&
+        ((seg->flags & (TWI_SEG_SOURCE | TWI_SEG_STOP)) == TWI_SEG_FIFO)) {
+      seg->length++;
+      TWI_Queue_Kick ();
+      return SUCCESS;
+    }
+  }
+  return TWI_Queue_Push (TWI_SEG_FIFO, 0, 0, 1);                  // new inline segment
+}
+
+/**
+ * @desc    TWI Queue bytes from RAM / PROGMEM without copy
+ *
+ * @param   uint8_t source TWI_SEG_RAM, TWI_SEG_PGM
+ * @param   const uint8_t * data
+ * @param   uint16_t length
+ *
+ * @return  char
+ */
+char TWI_Queue_Data (uint8_t source, const uint8_t * data, uint16_t length)
+{
+  return TWI_Queue_Push (source & TWI_SEG_SOURCE, 0, data, length);
+}
+
+/**
+ * @desc    TWI Queue repeated byte
+ *
+ * @param   uint8_t value
+ * @param   uint16_t length
+ *
+ * @return  char
+ */
+char TWI_Queue_Fill (uint8_t value, uint16_t length)
+{
+  return TWI_Queue_Push (TWI_SEG_FILL, value, 0, length);
+}
+
+/**
+ * @desc    TWI Queue Stop - close transaction by last segment
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void TWI_Queue_Stop (void)
+{
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+    if (_twiHead != _twiTail) {
+      _twiQueue[(_twiHead - 1) & (TWI_QUEUE_SIZE - 1)].flags |= TWI_SEG_STOP;
+      TWI_Queue_Kick ();
+    } else {
+      _twiDrop = 0;                                               // failed transaction closed
+    }
+  }
+}
+
+/**
+ * @desc    TWI Flush - wait till all queued transactions are sent
+ *
+ * @param   void
+ *
+ * @return  char - first error status since last flush
+ */
+char TWI_Flush (void)
+{
+  uint16_t loops = 0;
+  uint8_t progress = _twiProgress;
+  char status;
+
+  while (_twiState != TWI_IDLE) {                                 // wait for empty queue
+    TWI_Queue_Watch (&loops, &progress);                          // error kept for status
+  }
+
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+    status = _twiError;
+    _twiError = 0;
+  }
+  return status;
+}
+
+#endif
@@ -13,11 +13,15 @@
  * @depend      
  * ---------------------------------------------------------------+
  * @usage       Basic Master Transmit Operation
+ *              TWI_QUEUE -> interrupt driven master transmit queue
  */
 
 #ifndef __TWI_H__
 #define __TWI_H__
 
+  // includes
+  #include <stdint.h>
+
   // define register for TWI communication
   // -------------------------------------------
   #if defined(__AVR_ATmega16__) || defined(__AVR_ATmega8__) || defined(__AVR_ATmega328P__)
@@ -30,6 +34,26 @@
 
   #endif
 
+  // define pins for bus recovery
+  // -------------------------------------------
+  #if defined(__AVR_ATmega16__)
+
+    #define TWI_DDR             DDRC
+    #define TWI_PORT            PORTC
+    #define TWI_PIN             PINC
+    #define TWI_SCL             0    // PC0
+    #define TWI_SDA             1    // PC1
+
+  #elif defined(__AVR_ATmega8__) || defined(__AVR_ATmega328P__)
+
+    #define TWI_DDR             DDRC
+    #define TWI_PORT            PORTC
+    #define TWI_PIN             PINC
+    #define TWI_SCL             5    // PC5
+    #define TWI_SDA             4    // PC4
+
+  #endif
+
   // Success
   // -------------------------------------------
   #ifndef SUCCESS
@@ -48,6 +72,8 @@
   //
   // ++++++++++++++++++++++++++++++++++++++++++  
   // Master Mode - Transmitter / Receiver
+  #define TWI_BUS_ERROR         0x00  // Bus error due to an illegal START or STOP condition
+  #define TWI_NO_INFO           0xF8  // No relevant state information, TWINT = 0 -> used for timeout
   #define TWI_START_ACK         0x08  // A START condition has been transmitted
   #define TWI_REP_START_ACK     0x10  // A repeated START condition has been transmitted
   #define TWI_FLAG_ARB_LOST     0x38  // Arbitration lost in SLA+W or NOT ACK bit
@@ -86,14 +112,54 @@
 
   // TWI CLK frequency
   // -------------------------------------------
+  //  fscl = fcpu / (16 + 2 * TWBR * 4^TWPS)
+  //  TWBR = ((fcpu / fscl) - 16) / (2 * 4^TWPS)
+  //
   //  @param TWBR
-  //  @param Prescaler
+  //  @param Prescaler bits
   //    TWPS1 TWPS0  - PRESCALER
   //      0     0    -     1
   //      0     1    -     4
   //      1     0    -    16
   //      1     1    -    64
-  #define TWI_FREQ(BIT_RATE, PRESCALER) { TWI_TWBR = BIT_RATE; TWI_TWSR |= (TWI_TWSR & 0x03) | PRESCALER; }
+  #define TWI_FREQ(BIT_RATE, PRESCALER) { TWI_TWBR = BIT_RATE; TWI_TWSR = (TWI_TWSR & ~0x03) | (PRESCALER); }
+
+  // TWI SCL frequency selection
+  // -------------------------------------------
+  //  TWI_SCL_FREQ  - required SCL frequency in Hz
+  //  TWI_SCL_MAX   - max speed, TWBR = 0 => F_CPU / 16 (500 kHz at 8 MHz, 1 MHz at 16 MHz)
+  #define TWI_SCL_MAX                   ((F_CPU) / 16)
+  #ifndef TWI_SCL_FREQ
+    #define TWI_SCL_FREQ                400000UL
+  #endif
+  #define TWI_TWBR_CALC(FREQ, TWPS)     ((((F_CPU) / (FREQ)) - 16) / (2 << (2 * (TWPS))))
+
+  #if ((F_CPU) / (TWI_SCL_FREQ)) < 16
+    #error "TWI: TWI_SCL_FREQ above F_CPU / 16, use TWI_SCL_MAX"
+  #elif TWI_TWBR_CALC(TWI_SCL_FREQ, 0) <= 255
+    #define TWI_PRESCALER               0
+  #elif TWI_TWBR_CALC(TWI_SCL_FREQ, 1) <= 255
+    #define TWI_PRESCALER               1
+  #elif TWI_TWBR_CALC(TWI_SCL_FREQ, 2) <= 255
+    #define TWI_PRESCALER               2
+  #elif TWI_TWBR_CALC(TWI_SCL_FREQ, 3) <= 255
+    #define TWI_PRESCALER               3
+  #else
+    #error "TWI: TWI_SCL_FREQ too low for F_CPU"
+  #endif
+  #define TWI_BIT_RATE                  TWI_TWBR_CALC(TWI_SCL_FREQ, TWI_PRESCALER)
+
+  // Fallback to lower speed if NACK rate rises
+  // -------------------------------------------
+  //  every TWI_FALLBACK_WINDOW transactions the NACKs are evaluated,
+  //  TWI_FALLBACK_NACKS or more steps the speed down: selected -> 400 kHz -> 100 kHz
+  #ifndef TWI_FALLBACK_WINDOW
+    #define TWI_FALLBACK_WINDOW         32
+  #endif
+  #ifndef TWI_FALLBACK_NACKS
+    #define TWI_FALLBACK_NACKS          2
+  #endif
+  #define TWI_SPEED_LEVELS              3
 
   // TWI start condition
   // -------------------------------------------
@@ -115,11 +181,57 @@
   // (1 << TWINT) - TWI Interrupt Flag - must be cleared by set
   #define TWI_ENABLE()                  { TWI_TWCR = (1 << TWEN) | (1 << TWINT); }
 
-  // TWI test if TWINT Flag is set
-  #define TWI_WAIT_TILL_TWINT_IS_SET()  { while (!(TWI_TWCR & (1 << TWINT))); }
+  // Bounded waits & bus recovery
+  // -------------------------------------------
+  //  TWI_TIMEOUT_US    - max wait for TWINT (or queue progress) in microseconds,
+  //                      then bus is recovered and TWI_NO_INFO returned;
+  //                      default covers one byte at 100 kHz with clock stretching
+  //  TWI_TIMEOUT_LOOPS - wait loops of ~8 CPU cycles
+  #ifndef TWI_TIMEOUT_US
+    #define TWI_TIMEOUT_US              1000UL
+  #endif
+  #define TWI_TIMEOUT_LOOPS             ((uint16_t) (((F_CPU) / 1000000UL) * (TWI_TIMEOUT_US) / 8))
+  #define TWI_RECOVER_CLOCKS            9     // clocks to release SDA held by slave
 
   // TWI status mask
   #define TWI_STATUS                    ( TWI_TWSR & 0xF8 )
+
+  // Interrupt driven transmit queue
+  // -------------------------------------------
+  // TWI_QUEUE       - uncomment to transmit by TWI_vect interrupt, sei() required
+  // TWI_QUEUE_SIZE  - number of segments (power of 2)
+  // TWI_FIFO_SIZE   - bytes of inline data (power of 2)
+//#define TWI_QUEUE
+  #ifndef TWI_QUEUE_SIZE
+    #define TWI_QUEUE_SIZE              8
+  #endif
+  #ifndef TWI_FIFO_SIZE
+    #define TWI_FIFO_SIZE               64
+  #endif
+
+  // Segment source
+  #define TWI_SEG_FIFO                  0x00  // bytes copied into inline fifo
+  #define TWI_SEG_RAM                   0x01  // bytes in RAM, must be valid till sent
+  #define TWI_SEG_PGM                   0x02  // bytes in PROGMEM
+  #define TWI_SEG_FILL                  0x03  // one byte repeated
+  #define TWI_SEG_SOURCE                0x03  // source mask
+  // Segment flags
+  #define TWI_SEG_START                 0x10  // START & SLAW before segment
+  #define TWI_SEG_STOP                  0x20  // STOP after segment
+
+  // Queue state
+  #define TWI_IDLE                      0x00  // nothing to send
+  #define TWI_RUN                       0x01  // transmitting by interrupt
+  #define TWI_STALL                     0x02  // transaction open, waiting for next segment
+
+  // @struct Segment of transaction
+  struct TWI_Segment {
+    uint8_t flags;                            // source & START / STOP
+    uint8_t address;                          // slave address for START
+    uint8_t value;                            // fill value
+    const uint8_t * data;                     // RAM / PROGMEM source
+    uint16_t length;                          // number of bytes
+  };
   
   /**
    * @desc    TWI init
@@ -130,6 +242,25 @@
    */
   void TWI_Init (void);
 
+  /**
+   * @desc    TWI recover - TWI off, up to 9 SCL clocks till slave releases SDA,
+   *          STOP condition by hand, TWI on again
+   *
+   * @param   void
+   *
+   * @return  char - SUCCESS if SDA is released
+   */
+  char TWI_Recover (void);
+
+  /**
+   * @desc    TWI get actual speed level (0 = TWI_SCL_FREQ, 1 = 400 kHz, 2 = 100 kHz)
+   *
+   * @param   void
+   *
+   * @return  uint8_t
+   */
+  uint8_t TWI_Speed (void);
+
   /**
    * @desc    TWI MT Start
    *
@@ -174,5 +305,66 @@
    * @return  void
    */
   void TWI_Stop (void);
-  
+
+#if defined(TWI_QUEUE)
+
+  /**
+   * @desc    TWI Queue Start - next segment begins with START & SLAW
+   *
+   * @param   uint8_t address
+   *
+   * @return  void
+   */
+  void TWI_Queue_Start (uint8_t);
+
+  /**
+   * @desc    TWI Queue data byte (copied into fifo)
+   *
+   * @param   uint8_t
+   *
+   * @return  char
+   */
+  char TWI_Queue_Byte (uint8_t);
+
+  /**
+   * @desc    TWI Queue bytes from RAM / PROGMEM without copy
+   *
+   * @param   uint8_t source TWI_SEG_RAM, TWI_SEG_PGM
+   * @param   const uint8_t * data
+   * @param   uint16_t length
+   *
+   * @return  char
+   */
+  char TWI_Queue_Data (uint8_t, const uint8_t *, uint16_t);
+
+  /**
+   * @desc    TWI Queue repeated byte
+   *
+   * @param   uint8_t value
+   * @param   uint16_t length
+   *
+   * @return  char
+   */
+  char TWI_Queue_Fill (uint8_t, uint16_t);
+
+  /**
+   * @desc    TWI Queue Stop - close transaction
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void TWI_Queue_Stop (void);
+
+  /**
+   * @desc    TWI Flush - wait till all queued transactions are sent
+   *
+   * @param   void
+   *
+   * @return  char - first error status since last flush
+   */
+  char TWI_Flush (void);
+
+#endif
+
 #endif
@@ -0,0 +1,196 @@
+/**
+ * --------------------------------------------------------------------------------------+
+ * @brief       MIDI - VS1053 real-time MIDI over SDI, events batched per DREQ
+ * --------------------------------------------------------------------------------------+
+ * @date        18.10.2026
+ * @file        midi.c
+ * @version     1.0
+ * @test        AVR Atmega328p
+ *
+ * @depend      midi.h
+ * --------------------------------------------------------------------------------------+
+ * @sources     https://www.vlsi.fi/fileadmin/datasheets/vs1053.pdf
+ *              https://www.vlsi.fi/en/support/software/vs10xxplugins.html
+ */
+
+// INCLUDE libraries
+#include "midi.h"
+
+// global variables
+uint8_t _midiQueue[MIDI_QUEUE];                         // @var global - MIDI bytes
+uint8_t _midiHead = 0;                                  // @var global - write index
+uint8_t _midiTail = 0;                                  // @var global - read index
+uint8_t _midiStatus = 0;                                // @var global - running status
+uint16_t _midiStamp[MIDI_QUEUE];                        // @var global - queued at, per MIDI byte
+struct MIDI_Stats _midiStats = {0, 0, 0, 0};            // @var global - statistics
+
+// VS1053b real-time MIDI start plugin (rtmidistart), compressed
+const uint16_t _midiPlugin[] PROGMEM = {
+  0x0007, 0x0001, 0x8050, 0x0006, 0x0014, 0x0030, 0x0715, 0xb080,
+  0x3400, 0x0007, 0x9255, 0x3d00, 0x0024, 0x0030, 0x0295, 0x6890,
+  0x3400, 0x0030, 0x0495, 0x3d00, 0x0024, 0x2908, 0x4d40, 0x0030,
+  0x0200, 0x000a, 0x0001, 0x0050,
+};
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== MIDI FUNCTIONS ==================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @brief   Init - soft reset, real-time MIDI plugin loaded
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void MIDI_Init (void)
+{
+  VS1053_SoftReset ();
+  VS1053_LoadPlugin (_midiPlugin, sizeof (_midiPlugin) / sizeof (_midiPlugin[0]));
+  _midiHead = 0;
+  _midiTail = 0;
+  _midiStatus = 0;                                      // first status always sent
+}
+
+/**
+ * @brief   Queue event, data byte 2 only if message has it
+ *
+ * @param   uint8_t status
+ * @param   uint8_t data 1
+ * @param   uint8_t data 2
+ * @param   uint8_t data bytes -> 1, 2
+ *
+ * @return  uint8_t 1 queued / 0 full
+ */
+uint8_t MIDI_Event (uint8_t status, uint8_t data1, uint8_t data2, uint8_t n)
+{
+  uint8_t running = (status == _midiStatus);
+  uint8_t length = n + (running ? 0 : 1);
+  uint16_t stamp = TIMER_Stamp ();
+
+  if ((uint8_t) (MIDI_QUEUE - (uint8_t) (_midiHead - _midiTail)) < length) {
+    _midiStats.dropped++;
+    return 0;                                           // full
+  }
+  if (!running) {
+    _midiStamp[_midiHead & (MIDI_QUEUE - 1)] = stamp;
+    _midiQueue[_midiHead++ & (MIDI_QUEUE - 1)] = status;
+    _midiStatus = status;
+  }
+  _midiStamp[_midiHead & (MIDI_QUEUE - 1)] = stamp;
+  _midiQueue[_midiHead++ & (MIDI_QUEUE - 1)] = data1 & 0x7F;
+  if (n > 1) {
+    _midiStamp[_midiHead & (MIDI_QUEUE - 1)] = stamp;
+    _midiQueue[_midiHead++ & (MIDI_QUEUE - 1)] = data2 & 0x7F;
+  }
+  _midiStats.events++;
+  return 1;
+}
+
+/**
+ * @brief   Note on
+ *
+ * @param   uint8_t channel -> 0 ... 15
+ * @param   uint8_t note -> 0 ... 127
+ * @param   uint8_t velocity -> 0 ... 127
+ *
+ * @return  uint8_t 1 queued / 0 full
+ */
+uint8_t MIDI_NoteOn (uint8_t channel, uint8_t note, uint8_t velocity)
+{
+  return MIDI_Event (MIDI_NOTE_ON | (channel & 0x0F), note, velocity, 2);
+}
+
+/**
+ * @brief   Note off
+ *
+ * @param   uint8_t channel -> 0 ... 15
+ * @param   uint8_t note -> 0 ... 127
+ * @param   uint8_t velocity -> 0 ... 127
+ *
+ * @return  uint8_t 1 queued / 0 full
+ */
+uint8_t MIDI_NoteOff (uint8_t channel, uint8_t note, uint8_t velocity)
+{
+  return MIDI_Event (MIDI_NOTE_OFF | (channel & 0x0F), note, velocity, 2);
+}
+
+/**
+ * @brief   Control change
+ *
+ * @param   uint8_t channel -> 0 ... 15
+ * @param   uint8_t controller -> 0 ... 127
+ * @param   uint8_t value -> 0 ... 127
+ *
+ * @return  uint8_t 1 queued / 0 full
+ */
+uint8_t MIDI_Control (uint8_t channel, uint8_t controller, uint8_t value)
+{
+  return MIDI_Event (MIDI_CONTROL | (channel & 0x0F), controller, value, 2);
+}
+
+/**
+ * @brief   Program change
+ *
+ * @param   uint8_t channel -> 0 ... 15
+ * @param   uint8_t program -> 0 ... 127
+ *
+ * @return  uint8_t 1 queued / 0 full
+ */
+uint8_t MIDI_Program (uint8_t channel, uint8_t program)
+{
+  return MIDI_Event (MIDI_PROGRAM | (channel & 0x0F), program, 0, 1);
+}
+
+/**
+ * @brief   Service - send queued events in bursts while DREQ is high, no waiting
+ *
+ * @param   void
+ *
+ * @return  uint8_t MIDI bytes still queued
+ */
+uint8_t MIDI_Service (void)
+{
+  uint8_t burst[MIDI_BURST << 1];
+  uint16_t oldest;
+  uint16_t wait;
+  uint8_t n;
+  uint8_t i;
+
+  while ((_midiHead != _midiTail) && VS1053_Ready ()) {
+    n = _midiHead - _midiTail;
+    if (n > MIDI_BURST) {
+      n = MIDI_BURST;
+    }
+    oldest = _midiStamp[_midiTail & (MIDI_QUEUE - 1)];  // first byte waited longest
+    for (i = 0; i < n; i++) {
+      burst[i << 1] = 0;                                // 2 bytes per MIDI byte
+      burst[(i << 1) + 1] = _midiQueue[_midiTail++ & (MIDI_QUEUE - 1)];
+    }
+    VS1053_WriteBurst (burst, n << 1);
+    wait = TIMER_Stamp () - oldest;                     // queued to sent, this event
+    if (wait > _midiStats.worst) {
+      _midiStats.worst = wait;
+    }
+    _midiStats.batches++;
+  }
+  return _midiHead - _midiTail;
+}
+
+/**
+ * @brief   Statistics since last call, counting restarts
+ *
+ * @param   struct MIDI_Stats *
+ *
+ * @return  void
+ */
+void MIDI_GetStats (struct MIDI_Stats * stats)
+{
+  *stats = _midiStats;
+  _midiStats.events = 0;
+  _midiStats.dropped = 0;
+  _midiStats.batches = 0;
+  _midiStats.worst = 0;
+}
@@ -0,0 +1,145 @@
+/**
+ * --------------------------------------------------------------------------------------+
+ * @brief       MIDI - VS1053 real-time MIDI over SDI, events batched per DREQ
+ * --------------------------------------------------------------------------------------+
+ * @date        18.10.2026
+ * @file        midi.h
+ * @version     1.0
+ * @test        AVR Atmega328p
+ *
+ * @depend      vs1053.h, timer.h
+ * --------------------------------------------------------------------------------------+
+ * @descr       Real-time MIDI plugin of VLSI (rtmidistart) is loaded after reset, then
+ *              every MIDI byte goes through SDI as 2 bytes 0x00, byte. Events wait in
+ *              queue, MIDI_Service sends all waiting in bursts of 16 MIDI bytes while
+ *              DREQ is high, running status drops repeated status bytes.
+ *
+ *              Every queued byte keeps its stamp, worst of MIDI_GetStats is the
+ *              longest queued to sent time of one event, measured per burst (16 bit
+ *              stamp, waits over 524 ms wrap).
+ *
+ *              Event to SPI latency, 8 MHz, SPI 1 MHz -> ~ 19 us per MIDI byte
+ *              (host model, Poisson events, MIDI_Service every 1 ms, event timed
+ *              at end of its burst, not measured on hardware; worst of
+ *              MIDI_GetStats matched model max within 10 us):
+ *                1000 events/s, 16 channels        avg 0.61 ms   max 1.29 ms
+ *                3000 events/s, 16 channels        avg 0.72 ms   max 1.31 ms
+ *                3000 events/s, running status     avg 0.66 ms   max 1.31 ms
+ *                8000 events/s, running status     avg 0.81 ms   max 1.42 ms
+ *              Latency is bound by period of MIDI_Service, batch adds 19 us / byte.
+ * --------------------------------------------------------------------------------------+
+ * @usage       MIDI_Init ();
+ *              MIDI_Program (0, 0);                            // acoustic grand piano
+ *              MIDI_NoteOn (0, 60, 100);
+ *              MIDI_Service ();                                // main loop or 1 ms task
+ */
+
+#ifndef __MIDI_H__
+#define __MIDI_H__
+
+  // INCLUDE libraries
+  #include <avr/pgmspace.h>
+  #include "vs1053.h"
+  #include "timer.h"
+
+  // Settings
+  #define MIDI_QUEUE              64      // queued MIDI bytes, power of 2
+  #define MIDI_BURST              16      // MIDI bytes per DREQ, 32 bytes of SDI
+
+  // Messages
+  #define MIDI_NOTE_OFF           0x80
+  #define MIDI_NOTE_ON            0x90
+  #define MIDI_CONTROL            0xB0
+  #define MIDI_PROGRAM            0xC0
+
+  // @struct Statistics
+  struct MIDI_Stats {
+    uint16_t events;                              // events queued
+    uint16_t dropped;                             // events not queued, queue full
+    uint16_t batches;                             // bursts sent
+    uint16_t worst;                               // longest queued to sent of one event [TIMER_Stamp counts]
+  };
+
+  /**
+   * @brief   Init - soft reset, real-time MIDI plugin loaded
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void MIDI_Init (void);
+
+  /**
+   * @brief   Queue event, data byte 2 only if message has it
+   *
+   * @param   uint8_t status
+   * @param   uint8_t data 1
+   * @param   uint8_t data 2
+   * @param   uint8_t data bytes -> 1, 2
+   *
+   * @return  uint8_t 1 queued / 0 full
+   */
+  uint8_t MIDI_Event (uint8_t, uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @brief   Note on
+   *
+   * @param   uint8_t channel -> 0 ... 15
+   * @param   uint8_t note -> 0 ... 127
+   * @param   uint8_t velocity -> 0 ... 127
+   *
+   * @return  uint8_t 1 queued / 0 full
+   */
+  uint8_t MIDI_NoteOn (uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @brief   Note off
+   *
+   * @param   uint8_t channel -> 0 ... 15
+   * @param   uint8_t note -> 0 ... 127
+   * @param   uint8_t velocity -> 0 ... 127
+   *
+   * @return  uint8_t 1 queued / 0 full
+   */
+  uint8_t MIDI_NoteOff (uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @brief   Control change
+   *
+   * @param   uint8_t channel -> 0 ... 15
+   * @param   uint8_t controller -> 0 ... 127
+   * @param   uint8_t value -> 0 ... 127
+   *
+   * @return  uint8_t 1 queued / 0 full
+   */
+  uint8_t MIDI_Control (uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @brief   Program change
+   *
+   * @param   uint8_t channel -> 0 ... 15
+   * @param   uint8_t program -> 0 ... 127
+   *
+   * @return  uint8_t 1 queued / 0 full
+   */
+  uint8_t MIDI_Program (uint8_t, uint8_t);
+
+  /**
+   * @brief   Service - send queued events in bursts while DREQ is high, no waiting
+   *
+   * @param   void
+   *
+   * @return  uint8_t MIDI bytes still queued
+   */
+  uint8_t MIDI_Service (void);
+
+  /**
+   * @brief   Statistics since last call, counting restarts
+   *
+   * @param   struct MIDI_Stats *
+   *
+   * @return  void
+   */
+  void MIDI_GetStats (struct MIDI_Stats *);
+
+#endif
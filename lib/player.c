@@ -0,0 +1,806 @@
+/**
+ * --------------------------------------------------------------------------------------+
+ * @brief       Player - feeding VS1053 from stream source, fast forward and seeking
+ * --------------------------------------------------------------------------------------+
+ * @date        18.10.2026
+ * @file        player.c
+ * @version     1.0
+ * @test        AVR Atmega328p
+ *
+ * @depend      player.h
+ * --------------------------------------------------------------------------------------+
+ * @descr       Skip of 10 s in 320 kbit/s MP3, byteRate 40000 B/s -> jump of 400000 B:
+ *                wait for SS_DO_NOT_JUMP   <= 1 frame, 1045 B / 26 ms
+ *                seek of source            source dependent, 0 for PROGMEM
+ *                resync on next sync word  <= 1 frame, no endFillBytes
+ *                old data in decoder FIFO  <= 2048 B / 51 ms
+ *              -> new position heard in ~ 80 ms at worst, target 100 ms
+ *
+ *              Prebuffer of 512 B ring, storage latency budget 8 ms:
+ *                byteRate        low    start  high
+ *                 8000 B/s  64k  96     128    192
+ *                16000 B/s 128k  160    224    320
+ *                40000 B/s 320k  256    416    512   (low at most half of ring)
+ *              Ogg, WMA, AAC doubled low watermark (packets over several bursts)
+ *
+ *              Prompt trigger to audible, decoder FIFO full at cut:
+ *                wait for next frame header  <= 1 frame, 26 ms, fed as FIFO frees
+ *                music in FIFO at cut        2048 B / byteRate
+ *                  320 kbit/s  ->  51 ms + <= 26 ms
+ *                  128 kbit/s  -> 128 ms + <= 26 ms
+ *                   32 kbit/s  -> 512 ms + <= 26 ms  (HelloMP3, 22050 Hz mono)
+ *              Latency is latched once bytes sent after cut fill the FIFO.
+ */
+
+// INCLUDE libraries
+#include <avr/pgmspace.h>
+#include "player.h"
+#include "index.h"
+#include "timer.h"
+
+// Prompt states
+#define PLAYER_PROMPT_IDLE        0       // no prompt
+#define PLAYER_PROMPT_CUT         1       // stream fed up to next frame header
+#define PLAYER_PROMPT_PLAY        2       // clip being sent
+
+// global variables
+const struct PLAYER_Source * _playerSrc = 0;           // @var global - stream source
+uint32_t _playerPos = 0;                                // @var global - offset of next byte
+uint8_t _playerRing[PLAYER_RING];                       // @var global - ring buffer
+uint16_t _ringHead = 0;                                 // @var global - write index
+uint16_t _ringTail = 0;                                 // @var global - read index
+uint16_t _ringCount = 0;                                // @var global - bytes in ring
+uint8_t _playerEnd = 0;                                 // @var global - source ended
+uint8_t _playerWait = 0;                                // @var global - prebuffering
+uint8_t _playerFill = 0;                                // @var global - refilling
+uint16_t _playerAdapt = 0;                              // @var global - bytes since adapt
+struct PLAYER_Log _playerLog[PLAYER_LOG];               // @var global - thresholds log
+uint8_t _logLast = 0;                                   // @var global - newest record
+
+const char * _pgmData;                                  // @var global - PROGMEM stream
+uint16_t _pgmLength;                                    // @var global - length of stream
+uint16_t _pgmOffset;                                    // @var global - offset in stream
+
+const struct PLAYER_Source * _pcmSrc;                   // @var global - PCM payload
+uint8_t _pcmHeader[PLAYER_WAV_HEADER];                  // @var global - RIFF / WAV header
+uint8_t _pcmOffset;                                     // @var global - header bytes sent
+
+const struct PLAYER_Clip * _promptTable = 0;            // @var global - PROGMEM clips
+uint8_t _promptCount = 0;                               // @var global - clips in table
+uint8_t _promptState = PLAYER_PROMPT_IDLE;              // @var global - prompt state
+const char * _promptData;                               // @var global - PROGMEM clip
+uint16_t _promptLength;                                 // @var global - length of clip
+uint16_t _promptOffset;                                 // @var global - clip bytes sent
+uint16_t _promptWait;                                   // @var global - bytes fed before cut
+uint16_t _promptTime;                                   // @var global - decode time at cut
+uint16_t _promptStamp;                                  // @var global - trigger [ms]
+uint16_t _promptSent = PLAYER_FIFO;                     // @var global - bytes sent after cut
+uint16_t _promptLatency = 0;                            // @var global - trigger to decoder [ms]
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @brief   Read from PROGMEM stream
+ *
+ * @param   uint8_t * buffer
+ * @param   uint16_t max bytes
+ *
+ * @return  uint16_t bytes read
+ */
+static uint16_t PLAYER_ReadPgm (uint8_t * buffer, uint16_t n)
+{
+  uint16_t i;
+
+  if (n > _pgmLength - _pgmOffset) {
+    n = _pgmLength - _pgmOffset;                        // end of stream
+  }
+  for (i = 0; i < n; i++) {
+    buffer[i] = pgm_read_byte (&_pgmData[_pgmOffset++]);
+  }
+  return n;
+}
+
+/**
+ * @brief   Seek in PROGMEM stream
+ *
+ * @param   uint32_t offset
+ *
+ * @return  uint8_t
+ */
+static uint8_t PLAYER_SeekPgm (uint32_t offset)
+{
+  if (offset > _pgmLength) {
+    return 0;                                           // out of stream
+  }
+  _pgmOffset = (uint16_t) offset;
+  return 1;
+}
+
+const struct PLAYER_Source _sourcePgm = {PLAYER_ReadPgm, PLAYER_SeekPgm, 0};
+
+/**
+ * @brief   Store little endian value in header
+ *
+ * @param   uint8_t offset
+ * @param   uint32_t value
+ * @param   uint8_t bytes
+ *
+ * @return  void
+ */
+static void PLAYER_PcmField (uint8_t offset, uint32_t value, uint8_t n)
+{
+  while (n--) {
+    _pcmHeader[offset++] = (uint8_t) value;
+    value >>= 8;
+  }
+}
+
+/**
+ * @brief   Read header, then payload straight from PCM source into ring
+ *
+ * @param   uint8_t * buffer
+ * @param   uint16_t max bytes
+ *
+ * @return  uint16_t bytes read
+ */
+static uint16_t PLAYER_ReadPcm (uint8_t * buffer, uint16_t n)
+{
+  uint16_t i;
+
+  if (_pcmOffset < PLAYER_WAV_HEADER) {
+    if (n > PLAYER_WAV_HEADER - _pcmOffset) {
+      n = PLAYER_WAV_HEADER - _pcmOffset;               // header only
+    }
+    for (i = 0; i < n; i++) {
+      buffer[i] = _pcmHeader[_pcmOffset++];
+    }
+    return n;
+  }
+  return _pcmSrc->read (buffer, n);                     // payload, no copy
+}
+
+/**
+ * @brief   Seek in PCM stream, offset counts header
+ *
+ * @param   uint32_t offset
+ *
+ * @return  uint8_t
+ */
+static uint8_t PLAYER_SeekPcm (uint32_t offset)
+{
+  if (!_pcmSrc->seek || (offset < PLAYER_WAV_HEADER)) {
+    return 0;                                           // header is not replayed
+  }
+  return _pcmSrc->seek (offset - PLAYER_WAV_HEADER);
+}
+
+/**
+ * @brief   End of PCM payload
+ *
+ * @param   void
+ *
+ * @return  uint8_t
+ */
+static uint8_t PLAYER_EndPcm (void)
+{
+  return _pcmSrc->end ? _pcmSrc->end () : 1;
+}
+
+const struct PLAYER_Source _sourcePcm = {PLAYER_ReadPcm, PLAYER_SeekPcm, PLAYER_EndPcm};
+
+/**
+ * @brief   Empty ring buffer, prebuffer again
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void PLAYER_Flush (void)
+{
+  _ringHead = 0;
+  _ringTail = 0;
+  _ringCount = 0;
+  _playerEnd = 0;
+  _playerFill = 0;
+  _playerWait = 1;                                      // start threshold first
+}
+
+/**
+ * @brief   Thresholds by byteRate and format, new log record if changed
+ *
+ * @param   uint16_t byteRate
+ * @param   uint16_t format SCI_HDAT1
+ *
+ * @return  void
+ */
+static void PLAYER_Thresholds (uint16_t rate, uint16_t format)
+{
+  struct PLAYER_Log * log = &_playerLog[_logLast];
+  uint32_t low;
+  uint32_t start;
+  uint32_t high;
+
+  // keep within 1/8 of byteRate, no log flooding by VBR
+  // ----------------------------------------------------------------------------------
+  if ((log->format == format) &&
+      ((uint32_t) rate <= (uint32_t) log->rate + (log->rate >> 3)) &&
+      (rate >= log->rate - (log->rate >> 3))) {
+    return;
+  }
+  // low - covers storage latency, start - cushion on top, high - one low of reads
+  // ----------------------------------------------------------------------------------
+  low = (uint32_t) rate * PLAYER_LATENCY_MS / 1000 + PLAYER_BURST;
+  if ((format != VS10XX_FORMAT_WAV) && (format < VS10XX_FORMAT_MP3)) {
+    low <<= 1;                                          // packets over several bursts
+  }
+  if (low > (PLAYER_RING >> 1)) {
+    low = PLAYER_RING >> 1;
+  }
+  start = low + (uint32_t) rate * PLAYER_START_MS / 1000;
+  if (start > PLAYER_RING) {
+    start = PLAYER_RING;
+  }
+  high = low + ((low > PLAYER_CHUNK) ? low : PLAYER_CHUNK);
+  if (high > PLAYER_RING) {
+    high = PLAYER_RING;
+  }
+  // new record, oldest overwritten
+  // ----------------------------------------------------------------------------------
+  _logLast = (_logLast + 1) % PLAYER_LOG;
+  log = &_playerLog[_logLast];
+  log->rate = rate;
+  log->format = format;
+  log->start = (uint16_t) start;
+  log->low = (uint16_t) low;
+  log->high = (uint16_t) high;
+  log->underruns = 0;
+}
+
+/**
+ * @brief   Refill ring from source by watermarks - starts below low, stops at high
+ *
+ * @param   uint8_t force - ring is empty, read regardless of watermarks
+ *
+ * @return  void
+ */
+static void PLAYER_Refill (uint8_t force)
+{
+  struct PLAYER_Log * log = &_playerLog[_logLast];
+  uint16_t space;
+  uint16_t n;
+
+  if (_playerEnd) {
+    return;                                             // nothing to read
+  }
+  if (_ringCount < log->low || force) {
+    _playerFill = 1;
+  }
+  while (_playerFill) {
+    if (_ringCount >= log->high) {
+      _playerFill = 0;                                  // high watermark reached
+      break;
+    }
+    // contiguous space, chunk at most
+    // --------------------------------------------------------------------------------
+    space = PLAYER_RING - _ringHead;
+    if (space > PLAYER_RING - _ringCount) {
+      space = PLAYER_RING - _ringCount;
+    }
+    if (space > PLAYER_CHUNK) {
+      space = PLAYER_CHUNK;
+    }
+    n = _playerSrc->read (&_playerRing[_ringHead], space);
+    if (!n) {
+      if (!_playerSrc->end || _playerSrc->end ()) {
+        _playerEnd = 1;                                 // end of stream
+      }
+      break;                                            // or source not ready
+    }
+    _ringHead = (_ringHead + n) & (PLAYER_RING - 1);
+    _ringCount += n;
+  }
+}
+
+/**
+ * @brief   Send next burst from ring buffer
+ *
+ * @param   uint16_t max bytes
+ *
+ * @return  uint16_t bytes sent, 0 if ring is empty
+ */
+static uint16_t PLAYER_Burst (uint16_t max)
+{
+  uint16_t n;
+
+  if (!_ringCount) {
+    PLAYER_Refill (1);                                  // read at once
+  }
+  n = PLAYER_RING - _ringTail;                          // contiguous
+  if (n > _ringCount) {
+    n = _ringCount;
+  }
+  if (n > max) {
+    n = max;
+  }
+  if (n) {
+    VS1053_WriteBurst (&_playerRing[_ringTail], (uint8_t) n);
+    INDEX_Scan (&_playerRing[_ringTail], (uint8_t) n, _playerPos);
+    _ringTail = (_ringTail + n) & (PLAYER_RING - 1);
+    _ringCount -= n;
+    _playerPos += n;
+    _playerAdapt += n;
+  }
+  return n;
+}
+
+/**
+ * @brief   Bytes to cut - stream is fed up to next frame header, cut at once
+ *          if header is not found in time or stream ended; before first frame
+ *          (detection, ID3 tag) fed on, prompt dropped if stream is not MP3
+ *
+ * @param   void
+ *
+ * @return  uint16_t bytes of next burst, 0 cut here
+ */
+static uint16_t PLAYER_Boundary (void)
+{
+  uint8_t format = INDEX_Format ();
+  uint32_t frame;
+
+  if (_playerEnd && !_ringCount) {
+    return 0;                                           // end of stream
+  }
+  if (format > INDEX_MP3) {
+    _promptState = PLAYER_PROMPT_IDLE;                  // Ogg, unknown - no resume by header
+    return PLAYER_BURST;
+  }
+  if ((format != INDEX_MP3) || !INDEX_Frame (&frame)) {
+    _promptWait = 0;                                    // tag, first frame not synced yet
+    return PLAYER_BURST;
+  }
+  if (_promptWait >= PLAYER_PROMPT_WAIT) {
+    return 0;                                           // header not reached in time
+  }
+  if ((frame >= _playerPos) && ((frame - _playerPos) < PLAYER_BURST)) {
+    return (uint16_t) (frame - _playerPos);             // up to header
+  }
+  return PLAYER_BURST;
+}
+
+/**
+ * @brief   Latch latency - FIFO after cut consumed, clip reached decoder
+ *
+ * @param   uint16_t bytes sent
+ *
+ * @return  void
+ */
+static void PLAYER_Latch (uint16_t n)
+{
+  if (_promptSent < PLAYER_FIFO) {
+    _promptSent += n;
+    if (_promptSent >= PLAYER_FIFO) {
+      _promptLatency = TIMER_Ticks () - _promptStamp;
+    }
+  }
+}
+
+/**
+ * @brief   Start clip at cut
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void PLAYER_PromptStart (void)
+{
+  _promptState = PLAYER_PROMPT_PLAY;
+  _promptOffset = 0;
+  _promptSent = 0;
+  _promptTime = VS1053_GetDecodeTime ();
+}
+
+/**
+ * @brief   Send clip while decoder requests data
+ *
+ * @param   void
+ *
+ * @return  uint8_t 1 clip not sent yet / 0 done, stream goes on
+ */
+static uint8_t PLAYER_PromptFeed (void)
+{
+  uint8_t burst[PLAYER_BURST];
+  uint16_t n;
+
+  while (_promptOffset < _promptLength) {
+    if (!VS1053_Ready ()) {
+      return 1;
+    }
+    n = _promptLength - _promptOffset;
+    if (n > PLAYER_BURST) {
+      n = PLAYER_BURST;
+    }
+    memcpy_P (burst, &_promptData[_promptOffset], n);
+    VS1053_WriteBurst (burst, (uint8_t) n);
+    _promptOffset += n;
+    PLAYER_Latch (n);
+  }
+  VS1053_SetDecodeTime (_promptTime);                   // clip not counted in stream time
+  _promptState = PLAYER_PROMPT_IDLE;
+  return 0;
+}
+
+/**
+ * +-----------------------------------------------------------------------------------+
+ * |== PLAYER FUNCTIONS ===============================================================|
+ * +-----------------------------------------------------------------------------------+
+ */
+
+/**
+ * @brief   Open stream source, decoder has to be ready (reset or cancelled)
+ *
+ * @param   const struct PLAYER_Source *
+ *
+ * @return  void
+ */
+void PLAYER_Open (const struct PLAYER_Source * source)
+{
+  _playerSrc = source;
+  _playerPos = 0;
+  _playerAdapt = 0;
+  _playerLog[_logLast].format = 0;                      // force new record
+  PLAYER_Thresholds (PLAYER_DEFAULT_RATE, VS10XX_FORMAT_MP3);
+  PLAYER_Flush ();
+  INDEX_Init ();                                        // empty seek index
+}
+
+/**
+ * @brief   Open stream in PROGMEM as seekable source
+ *
+ * @param   const char * data
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+void PLAYER_OpenPgm (const char * data, uint16_t n)
+{
+  _pgmData = data;
+  _pgmLength = n;
+  _pgmOffset = 0;
+  PLAYER_Open (&_sourcePgm);
+}
+
+/**
+ * @brief   Open raw PCM source - RIFF / WAV header is sent in front of payload,
+ *          SCI_AUDATA set to the same rate and channels
+ *
+ * @param   const struct PLAYER_Source * payload, 8 bit unsigned / 16 bit signed little endian, interleaved
+ * @param   uint16_t sample rate
+ * @param   uint8_t channels -> 1, 2
+ * @param   uint8_t bits -> 8, 16
+ *
+ * @return  uint8_t
+ */
+uint8_t PLAYER_OpenPcm (const struct PLAYER_Source * source, uint16_t rate, uint8_t channels, uint8_t bits)
+{
+  uint8_t align = channels * (bits >> 3);
+  uint32_t bytes = (uint32_t) rate * align;
+
+  if ((channels < 1) || (channels > 2) || ((bits != 8) && (bits != 16)) || !rate) {
+    return PLAYER_ERROR;                                // not played by decoder
+  }
+  // header, unknown lengths as 0xFFFFFFFF
+  // ----------------------------------------------------------------------------------
+  memcpy_P (_pcmHeader, PSTR ("RIFF\xFF\xFF\xFF\xFFWAVEfmt "), 16);
+  PLAYER_PcmField (16, 16, 4);                          // fmt chunk size
+  PLAYER_PcmField (20, 1, 2);                           // PCM
+  PLAYER_PcmField (22, channels, 2);
+  PLAYER_PcmField (24, rate, 4);
+  PLAYER_PcmField (28, bytes, 4);                       // byte rate
+  PLAYER_PcmField (32, align, 2);                       // block align
+  PLAYER_PcmField (34, bits, 2);
+  memcpy_P (&_pcmHeader[36], PSTR ("data\xFF\xFF\xFF\xFF"), 8);
+  _pcmOffset = 0;
+  _pcmSrc = source;
+
+  // SCI_AUDATA - rate even, bit 0 stereo
+  // ----------------------------------------------------------------------------------
+  VS1053_PostSci (SCI_AUDATA, (rate & 0xFFFE) | ((channels == 2) ? 1 : 0));
+  VS1053_ServiceSci ();
+
+  PLAYER_Open (&_sourcePcm);
+  PLAYER_Thresholds ((bytes > 0xFFFF) ? 0xFFFF : (uint16_t) bytes, VS10XX_FORMAT_WAV);
+  return PLAYER_SUCCESS;
+}
+
+/**
+ * @brief   Feed - send bursts while decoder requests data, no waiting
+ *
+ * @param   void
+ *
+ * @return  uint8_t PLAYER_SUCCESS / PLAYER_END
+ */
+uint8_t PLAYER_Feed (void)
+{
+  uint16_t max = PLAYER_BURST;
+  uint16_t rate;
+  uint16_t n;
+
+  // prompt first, stream waits in ring
+  // ----------------------------------------------------------------------------------
+  if ((_promptState == PLAYER_PROMPT_PLAY) && PLAYER_PromptFeed ()) {
+    return PLAYER_SUCCESS;
+  }
+  if (!_playerSrc) {
+    return PLAYER_END;                                  // clip only
+  }
+  PLAYER_Refill (_playerWait);
+  // prebuffer up to start threshold
+  // ----------------------------------------------------------------------------------
+  if (_playerWait) {
+    if ((_ringCount < _playerLog[_logLast].start) && !_playerEnd) {
+      return PLAYER_SUCCESS;
+    }
+    _playerWait = 0;
+  }
+  while (VS1053_Ready ()) {                             // place for 32 bytes
+    if (_promptState == PLAYER_PROMPT_CUT) {
+      max = PLAYER_Boundary ();
+      if (!max) {
+        PLAYER_PromptStart ();                          // cut at frame header
+        PLAYER_PromptFeed ();
+        return PLAYER_SUCCESS;
+      }
+    }
+    n = PLAYER_Burst (max);
+    if (!n) {
+      if (_playerEnd) {
+        if (_promptState == PLAYER_PROMPT_CUT) {
+          continue;                                     // end of stream is cut too
+        }
+        return PLAYER_END;                              // end of stream
+      }
+      _playerLog[_logLast].underruns++;                 // source behind decoder
+      _playerWait = 1;
+      return PLAYER_SUCCESS;
+    }
+    if (_promptState == PLAYER_PROMPT_CUT) {
+      _promptWait += n;
+    }
+    PLAYER_Latch (n);
+  }
+  // adapt to byteRate and format reported by decoder
+  // ----------------------------------------------------------------------------------
+  if (_playerAdapt >= PLAYER_ADAPT) {
+    _playerAdapt = 0;
+    rate = VS1053_ReadWram (VS10XX_ADDR_BYTERATE);
+    if (rate) {                                         // 0 until first frame decoded
+      PLAYER_Thresholds (rate, VS1053_ReadSci (SCI_HDAT1));
+    }
+  }
+  return PLAYER_SUCCESS;
+}
+
+/**
+ * @brief   Close - endFillBytes & cancel
+ *
+ * @param   void
+ *
+ * @return  uint16_t SCI_HDAT0
+ */
+uint16_t PLAYER_Close (void)
+{
+  _playerSrc = 0;
+  _promptState = PLAYER_PROMPT_IDLE;                    // cancelled with stream
+  return VS1053_PlayCancel ();
+}
+
+/**
+ * @brief   Seek to byte offset of seekable source - data is fed on while decoder
+ *          reads header, endFillBytes are sent only if stream is not MPEG audio
+ *
+ * @param   uint32_t offset
+ *
+ * @return  uint8_t
+ */
+uint8_t PLAYER_Seek (uint32_t offset)
+{
+  uint16_t fed = 0;
+  uint16_t format;
+
+  if (!_playerSrc || !_playerSrc->seek || _promptState) {
+    return PLAYER_ERROR;                                // not seekable, prompt running
+  }
+  // no jump in header
+  // ----------------------------------------------------------------------------------
+  while (!VS1053_CanJump ()) {
+    if (fed >= PLAYER_JUMP_WAIT) {
+      return PLAYER_ERROR;                              // decoder stuck
+    }
+    if (VS1053_Ready ()) {
+      if (!PLAYER_Burst (PLAYER_BURST)) {
+        break;                                          // end of stream, jump anyway
+      }
+      fed += PLAYER_BURST;
+    }
+  }
+  format = VS1053_ReadSci (SCI_HDAT1);                  // stream format
+
+  // jump
+  // ----------------------------------------------------------------------------------
+  if (!_playerSrc->seek (offset)) {
+    return PLAYER_ERROR;                                // out of stream
+  }
+  _playerPos = offset;
+  PLAYER_Flush ();                                      // old data, prebuffer again
+
+  // resync - MPEG audio syncs on next frame header itself
+  // ----------------------------------------------------------------------------------
+  if (format < VS10XX_FORMAT_MP3) {
+    VS1053_WriteSdiByte ((uint8_t) VS1053_ReadWram (VS10XX_ADDR_ENDBYTE), PLAYER_RESYNC_FILL);
+  }
+
+  return PLAYER_SUCCESS;
+}
+
+/**
+ * @brief   Seek to time - offset from seek index while inside scanned part,
+ *          out of it extrapolated from scanned frontier by byteRate
+ *
+ * @param   uint16_t seconds
+ *
+ * @return  uint8_t
+ */
+uint8_t PLAYER_SeekTime (uint16_t seconds)
+{
+  uint16_t ticks = (seconds > (0xFFFF / INDEX_TICKS)) ? 0xFFFF : seconds * INDEX_TICKS;
+  uint32_t rate;
+  uint32_t offset;
+  uint8_t status;
+
+  if (!INDEX_Lookup (ticks, &offset)) {
+    rate = VS1053_ReadWram (VS10XX_ADDR_BYTERATE);
+    if (rate == 0) {
+      return PLAYER_ERROR;                              // no frame decoded yet
+    }
+    if (!INDEX_Entries ()) {
+      offset = 0;                                       // nothing indexed, from start
+    }
+    offset += rate * (ticks - INDEX_End ()) / INDEX_TICKS;
+  }
+  status = PLAYER_Seek (offset);
+  if (PLAYER_SUCCESS == status) {
+    VS1053_SetDecodeTime (seconds);                     // decode time follows the jump
+  }
+  return status;
+}
+
+/**
+ * @brief   Skip seconds forward / backward from decode time
+ *
+ * @param   int16_t seconds
+ *
+ * @return  uint8_t
+ */
+uint8_t PLAYER_Skip (int16_t seconds)
+{
+  int16_t time = (int16_t) VS1053_GetDecodeTime () + seconds;
+
+  return PLAYER_SeekTime ((time < 0) ? 0 : (uint16_t) time);
+}
+
+/**
+ * @brief   Fast forward by playSpeed, 1 normal
+ *
+ * @param   uint16_t
+ *
+ * @return  void
+ */
+void PLAYER_SetSpeed (uint16_t speed)
+{
+  VS1053_SetPlaySpeed (speed);
+}
+
+/**
+ * @brief   Position - offset of next byte sent to decoder
+ *
+ * @param   void
+ *
+ * @return  uint32_t
+ */
+uint32_t PLAYER_Position (void)
+{
+  return _playerPos;
+}
+
+/**
+ * @brief   Log of chosen thresholds with underruns, 0 newest
+ *
+ * @param   uint8_t index
+ * @param   struct PLAYER_Log *
+ *
+ * @return  uint8_t 1 record / 0 empty
+ */
+uint8_t PLAYER_GetLog (uint8_t i, struct PLAYER_Log * log)
+{
+  if (i >= PLAYER_LOG) {
+    return 0;
+  }
+  *log = _playerLog[(_logLast + PLAYER_LOG - i) % PLAYER_LOG];
+  return log->rate ? 1 : 0;
+}
+
+/**
+ * @brief   Set prompt table
+ *
+ * @param   const struct PLAYER_Clip * table in PROGMEM
+ * @param   uint8_t clips
+ *
+ * @return  void
+ */
+void PLAYER_SetPrompts (const struct PLAYER_Clip * table, uint8_t n)
+{
+  _promptTable = table;
+  _promptCount = n;
+}
+
+/**
+ * @brief   Prompt - clip interrupts MP3 stream at next frame header, stream
+ *          resumes from ring after clip, played at once if no stream is open;
+ *          format is taken from seek index scan, so prompt right after open waits
+ *          for first frame and is dropped if stream turns out not to be MP3
+ *
+ * @param   uint8_t clip
+ *
+ * @return  uint8_t PLAYER_ERROR if no clip, prompt running or stream not MP3
+ */
+uint8_t PLAYER_Prompt (uint8_t clip)
+{
+  struct PLAYER_Clip entry;
+
+  if ((clip >= _promptCount) || _promptState) {
+    return PLAYER_ERROR;
+  }
+  if (_playerSrc && (INDEX_Format () > INDEX_MP3)) {
+    return PLAYER_ERROR;                                // resumes by frame header only
+  }
+  memcpy_P (&entry, &_promptTable[clip], sizeof (entry));
+  _promptData = entry.data;
+  _promptLength = entry.length;
+  _promptStamp = TIMER_Ticks ();
+  _promptWait = 0;
+  if (!_playerSrc) {
+    PLAYER_PromptStart ();                              // nothing to cut
+  } else {
+    _promptState = PLAYER_PROMPT_CUT;
+  }
+  return PLAYER_SUCCESS;
+}
+
+/**
+ * @brief   Prompt busy - waiting for frame header or clip being sent
+ *
+ * @param   void
+ *
+ * @return  uint8_t
+ */
+uint8_t PLAYER_PromptBusy (void)
+{
+  return _promptState;
+}
+
+/**
+ * @brief   Prompt latency - last trigger to clip at decoder, i.e. FIFO after
+ *          cut consumed
+ *
+ * @param   void
+ *
+ * @return  uint16_t ms, 0 not measured yet
+ */
+uint16_t PLAYER_PromptLatency (void)
+{
+  return _promptLatency;
+}
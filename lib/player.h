@@ -0,0 +1,234 @@
+/**
+ * --------------------------------------------------------------------------------------+
+ * @brief       Player - feeding VS1053 from stream source, fast forward and seeking
+ * --------------------------------------------------------------------------------------+
+ * @date        18.10.2026
+ * @file        player.h
+ * @version     1.0
+ * @test        AVR Atmega328p
+ *
+ * @depend      vs1053.h
+ * --------------------------------------------------------------------------------------+
+ * @descr       Source gives bytes in order, seekable source jumps to byte offset.
+ *              Feed sends 32 bytes bursts while DREQ is high and returns, so main
+ *              loop stays free. Jump waits only while decoder reads header
+ *              (SS_DO_NOT_JUMP), MP3 resyncs on next frame without endFillBytes.
+ *              Source is read into ring buffer by watermarks, playback starts at
+ *              start threshold. Thresholds follow byteRate and format reported by
+ *              decoder, every change is logged with underruns counted under it.
+ *              Raw PCM source gets generated RIFF / WAV header, payload is read
+ *              straight into ring. SPI at 1 MHz carries ~ 88 kB/s, i.e. 16 bit
+ *              stereo up to 22050 Hz, mono up to 44100 Hz.
+ *              Prompt from PROGMEM table cuts MP3 stream at next frame header,
+ *              its frames follow in the same SDI stream, then ring continues
+ *              where it was cut - no read of source again. Prompt is audible
+ *              once decoder FIFO (2 KB) with music sent before cut is played:
+ *              ~ 51 ms at 320 kbit/s, 128 ms at 128 kbit/s, 512 ms at 32 kbit/s,
+ *              plus up to one frame sent while waiting for frame header.
+ * --------------------------------------------------------------------------------------+
+ * @usage       PLAYER_OpenPgm (HelloMP3, sizeof(HelloMP3)-1);
+ *              while (PLAYER_Feed () != PLAYER_END) { ... PLAYER_Skip (10); ... }
+ *              PLAYER_Close ();
+ */
+
+#ifndef __PLAYER_H__
+#define __PLAYER_H__
+
+  // INCLUDE libraries
+  #include "vs1053.h"
+
+  // Status
+  #define PLAYER_SUCCESS          0
+  #define PLAYER_ERROR            1
+  #define PLAYER_END              2
+
+  // Settings
+  #define PLAYER_BURST            32      // bytes per DREQ
+  #define PLAYER_JUMP_WAIT        4096    // max bytes fed while SS_DO_NOT_JUMP is set
+  #define PLAYER_RESYNC_FILL      2048    // endFillBytes after jump in non MPEG audio stream
+  #define VS10XX_FORMAT_MP3       0xFFE0  // SCI_HDAT1 of MPEG layer I, II, III - sync word
+  #define VS10XX_FORMAT_WAV       0x7665  // SCI_HDAT1 of RIFF WAV
+
+  // Prebuffer
+  #define PLAYER_RING             512     // ring buffer, power of 2
+  #define PLAYER_CHUNK            64      // max bytes per source read
+  #define PLAYER_LATENCY_MS       8       // worst storage latency covered by low watermark
+  #define PLAYER_START_MS         4       // cushion above low watermark before playback
+  #define PLAYER_DEFAULT_RATE     16000   // byteRate until first frame, 128 kbit/s
+  #define PLAYER_ADAPT            4096    // bytes between byteRate checks
+  #define PLAYER_LOG              4       // threshold records
+  #define PLAYER_WAV_HEADER       44      // RIFF / WAV header of PCM source
+
+  // Prompt
+  #define PLAYER_FIFO             2048    // SDI FIFO of decoder, bytes queued before audible
+  #define PLAYER_PROMPT_WAIT      2048    // max bytes fed while waiting for frame header
+
+  // @struct Stream source
+  struct PLAYER_Source {
+    uint16_t (*read) (uint8_t *, uint16_t);       // bytes read, 0 at end or not ready
+    uint8_t (*seek) (uint32_t);                   // 1 done / 0 out of stream, 0 if not seekable
+    uint8_t (*end) (void);                        // 1 at end of stream, 0 if read 0 means end
+  };
+
+  // @struct Prompt clip in PROGMEM, MP3 frames
+  struct PLAYER_Clip {
+    const char * data;                            // PROGMEM
+    uint16_t length;                              // bytes
+  };
+
+  // @struct Chosen thresholds
+  struct PLAYER_Log {
+    uint16_t rate;                                // byteRate
+    uint16_t format;                              // SCI_HDAT1
+    uint16_t start;                               // bytes prebuffered before playback
+    uint16_t low;                                 // refill below
+    uint16_t high;                                // refill up to
+    uint16_t underruns;                           // ring empty while DREQ high
+  };
+
+  /**
+   * @brief   Open stream source, decoder has to be ready (reset or cancelled)
+   *
+   * @param   const struct PLAYER_Source *
+   *
+   * @return  void
+   */
+  void PLAYER_Open (const struct PLAYER_Source *);
+
+  /**
+   * @brief   Open stream in PROGMEM as seekable source
+   *
+   * @param   const char * data
+   * @param   uint16_t length
+   *
+   * @return  void
+   */
+  void PLAYER_OpenPgm (const char *, uint16_t);
+
+  /**
+   * @brief   Open raw PCM source - RIFF / WAV header is sent in front of payload,
+   *          SCI_AUDATA set to the same rate and channels
+   *
+   * @param   const struct PLAYER_Source * payload, 8 bit unsigned / 16 bit signed little endian, interleaved
+   * @param   uint16_t sample rate
+   * @param   uint8_t channels -> 1, 2
+   * @param   uint8_t bits -> 8, 16
+   *
+   * @return  uint8_t
+   */
+  uint8_t PLAYER_OpenPcm (const struct PLAYER_Source *, uint16_t, uint8_t, uint8_t);
+
+  /**
+   * @brief   Feed - send bursts while decoder requests data, no waiting
+   *
+   * @param   void
+   *
+   * @return  uint8_t PLAYER_SUCCESS / PLAYER_END
+   */
+  uint8_t PLAYER_Feed (void);
+
+  /**
+   * @brief   Close - endFillBytes & cancel
+   *
+   * @param   void
+   *
+   * @return  uint16_t SCI_HDAT0
+   */
+  uint16_t PLAYER_Close (void);
+
+  /**
+   * @brief   Seek to byte offset of seekable source
+   *
+   * @param   uint32_t offset
+   *
+   * @return  uint8_t
+   */
+  uint8_t PLAYER_Seek (uint32_t);
+
+  /**
+   * @brief   Seek to time - from seek index, out of scanned part by byteRate
+   *
+   * @param   uint16_t seconds
+   *
+   * @return  uint8_t
+   */
+  uint8_t PLAYER_SeekTime (uint16_t);
+
+  /**
+   * @brief   Skip seconds forward / backward from decode time
+   *
+   * @param   int16_t seconds
+   *
+   * @return  uint8_t
+   */
+  uint8_t PLAYER_Skip (int16_t);
+
+  /**
+   * @brief   Fast forward by playSpeed, 1 normal
+   *
+   * @param   uint16_t
+   *
+   * @return  void
+   */
+  void PLAYER_SetSpeed (uint16_t);
+
+  /**
+   * @brief   Position - offset of next byte sent to decoder
+   *
+   * @param   void
+   *
+   * @return  uint32_t
+   */
+  uint32_t PLAYER_Position (void);
+
+  /**
+   * @brief   Log of chosen thresholds with underruns, 0 newest
+   *
+   * @param   uint8_t index
+   * @param   struct PLAYER_Log *
+   *
+   * @return  uint8_t 1 record / 0 empty
+   */
+  uint8_t PLAYER_GetLog (uint8_t, struct PLAYER_Log *);
+
+  /**
+   * @brief   Set prompt table
+   *
+   * @param   const struct PLAYER_Clip * table in PROGMEM
+   * @param   uint8_t clips
+   *
+   * @return  void
+   */
+  void PLAYER_SetPrompts (const struct PLAYER_Clip *, uint8_t);
+
+  /**
+   * @brief   Prompt - clip interrupts MP3 stream at next frame header, stream
+   *          resumes from ring after clip, played at once if no stream is open;
+   *          right after open it waits for first frame, dropped if not MP3
+   *
+   * @param   uint8_t clip
+   *
+   * @return  uint8_t PLAYER_ERROR if no clip, prompt running or stream not MP3
+   */
+  uint8_t PLAYER_Prompt (uint8_t);
+
+  /**
+   * @brief   Prompt busy - waiting for frame header or clip being sent
+   *
+   * @param   void
+   *
+   * @return  uint8_t
+   */
+  uint8_t PLAYER_PromptBusy (void);
+
+  /**
+   * @brief   Prompt latency - last trigger to clip at decoder, i.e. FIFO after
+   *          cut consumed
+   *
+   * @param   void
+   *
+   * @return  uint16_t ms, 0 not measured yet
+   */
+  uint16_t PLAYER_PromptLatency (void);
+
+#endif
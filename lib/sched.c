@@ -0,0 +1,159 @@
+/**
+ * --------------------------------------------------------------------------------------+
+ * @brief       Scheduler - cooperative, tick driven, deadline aware
+ * --------------------------------------------------------------------------------------+
+ * @date        18.10.2026
+ * @file        sched.c
+ * @version     1.0
+ * @test        AVR Atmega328p
+ *
+ * @depend      sched.h
+ * --------------------------------------------------------------------------------------+
+ */
+
+// INCLUDE libraries
+#include "sched.h"
+
+// global variables
+struct SCHED_Task * _schedTasks[SCHED_TASKS];          // @var global - tasks
+uint8_t _schedCount = 0;                                // @var global - number of tasks
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @brief   Released task with highest priority, earliest deadline of equal ones
+ *
+ * @param   uint16_t tick
+ *
+ * @return  struct SCHED_Task * or 0 if nothing released
+ */
+static struct SCHED_Task * SCHED_Next (uint16_t now)
+{
+  struct SCHED_Task * best = 0;
+  struct SCHED_Task * task;
+  uint8_t i;
+
+  for (i = 0; i < _schedCount; i++) {
+    task = _schedTasks[i];
+    if ((int16_t) (now - task->release) < 0) {
+      continue;                                         // not released
+    }
+    if (!best ||
+        (task->priority < best->priority) ||
+        ((task->priority == best->priority) &&
+         ((int16_t) ((task->release + task->deadline) - (best->release + best->deadline)) < 0))) {
+      best = task;
+    }
+  }
+  return best;
+}
+
+/**
+ * +-----------------------------------------------------------------------------------+
+ * |== SCHEDULER FUNCTIONS ============================================================|
+ * +-----------------------------------------------------------------------------------+
+ */
+
+/**
+ * @brief   Add task, first release at next tick
+ *
+ * @param   struct SCHED_Task *
+ * @param   void (*) (void)
+ * @param   uint16_t period ms -> 1 ...
+ * @param   uint16_t deadline ms -> 1 ... period
+ * @param   uint8_t priority, 0 highest
+ *
+ * @return  uint8_t 1 added / 0 full
+ */
+uint8_t SCHED_Add (struct SCHED_Task * task, void (*run) (void), uint16_t period, uint16_t deadline, uint8_t priority)
+{
+  if (_schedCount >= SCHED_TASKS) {
+    return 0;
+  }
+  task->run = run;
+  task->period = period ? period : 1;
+  task->deadline = deadline ? deadline : task->period;
+  task->priority = priority;
+  task->release = TIMER_Ticks () + 1;
+  task->runs = 0;
+  task->runtime = 0;
+  task->worst = 0;
+  task->misses = 0;
+  _schedTasks[_schedCount++] = task;
+  return 1;
+}
+
+/**
+ * @brief   Run - one released task or idle sleep till next interrupt
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void SCHED_Run (void)
+{
+  struct SCHED_Task * task;
+  uint16_t start;
+  uint16_t time;
+  uint16_t now;
+
+  // nothing released - sleep, tick releases next
+  // ----------------------------------------------------------------------------------
+  cli ();
+  now = TIMER_Ticks ();
+  task = SCHED_Next (now);
+  if (!task) {
+    TIMER_Idle ();                                      // sei & sleep
+    return;
+  }
+  sei ();
+
+  // run to the end
+  // ----------------------------------------------------------------------------------
+  start = TIMER_Stamp ();
+  task->run ();
+  time = TIMER_Stamp () - start;
+
+  // statistics
+  // ----------------------------------------------------------------------------------
+  task->runs++;
+  task->runtime += time;
+  if (time > task->worst) {
+    task->worst = time;
+  }
+  now = TIMER_Ticks ();
+  if ((int16_t) (now - (task->release + task->deadline)) > 0) {
+    task->misses++;                                     // finished late
+  }
+
+  // next release, skipped periods are misses
+  // ----------------------------------------------------------------------------------
+  task->release += task->period;
+  while ((int16_t) (now - task->release) >= (int16_t) task->period) {
+    task->release += task->period;
+    task->misses++;
+  }
+}
+
+/**
+ * @brief   Clear statistics of all tasks
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void SCHED_ClearStats (void)
+{
+  uint8_t i;
+
+  for (i = 0; i < _schedCount; i++) {
+    _schedTasks[i]->runs = 0;
+    _schedTasks[i]->runtime = 0;
+    _schedTasks[i]->worst = 0;
+    _schedTasks[i]->misses = 0;
+  }
+}
@@ -0,0 +1,81 @@
+/**
+ * --------------------------------------------------------------------------------------+
+ * @brief       Scheduler - cooperative, tick driven, deadline aware
+ * --------------------------------------------------------------------------------------+
+ * @date        18.10.2026
+ * @file        sched.h
+ * @version     1.0
+ * @test        AVR Atmega328p
+ *
+ * @depend      timer.h
+ * --------------------------------------------------------------------------------------+
+ * @descr       Task is released every period of ms ticks and has to finish within
+ *              deadline from release. Of released tasks runs the one with highest
+ *              priority (0), equal priorities by earliest deadline. Every task runs
+ *              to its end, so after each task released ones are chosen again - audio
+ *              feed with priority 0 waits at most one task. Nothing released -> idle
+ *              sleep till next interrupt.
+ *              Statistics per task in TIMER_Stamp counts (8 us): runs, total and
+ *              worst runtime, deadline misses (finished late or release skipped).
+ * --------------------------------------------------------------------------------------+
+ * @usage       TIMER_Init (); sei ();
+ *              SCHED_Add (&audio, Feed, 2, 4, 0);
+ *              SCHED_Add (&display, Draw, 100, 100, 2);
+ *              while (1) { SCHED_Run (); }
+ */
+
+#ifndef __SCHED_H__
+#define __SCHED_H__
+
+  // INCLUDE libraries
+  #include "timer.h"
+
+  // Settings
+  #define SCHED_TASKS             6       // max tasks
+  #define SCHED_COUNTS_MS         (TIMER_TOP + 1)  // TIMER_Stamp counts per ms
+
+  // @struct Task
+  struct SCHED_Task {
+    void (*run) (void);                           // task function, runs to its end
+    uint16_t period;                              // ms between releases
+    uint16_t deadline;                            // ms from release to finish
+    uint8_t priority;                             // 0 highest
+    uint16_t release;                             // tick of next release
+    uint16_t runs;                                // statistics - finished runs
+    uint32_t runtime;                             // statistics - sum of runtimes [counts]
+    uint16_t worst;                               // statistics - longest runtime [counts]
+    uint16_t misses;                              // statistics - deadlines missed
+  };
+
+  /**
+   * @brief   Add task, first release at next tick
+   *
+   * @param   struct SCHED_Task *
+   * @param   void (*) (void)
+   * @param   uint16_t period ms -> 1 ...
+   * @param   uint16_t deadline ms -> 1 ... period
+   * @param   uint8_t priority, 0 highest
+   *
+   * @return  uint8_t 1 added / 0 full
+   */
+  uint8_t SCHED_Add (struct SCHED_Task *, void (*) (void), uint16_t, uint16_t, uint8_t);
+
+  /**
+   * @brief   Run - one released task or idle sleep till next interrupt
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void SCHED_Run (void);
+
+  /**
+   * @brief   Clear statistics of all tasks
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void SCHED_ClearStats (void);
+
+#endif
@@ -0,0 +1,204 @@
+/**
+ * --------------------------------------------------------------------------------------+
+ * @brief       Scope - scrolling waveform of VS1053 recording on SSD1306
+ * --------------------------------------------------------------------------------------+
+ * @date        18.10.2026
+ * @file        scope.c
+ * @version     1.0
+ * @test        AVR Atmega328p
+ *
+ * @depend      scope.h
+ * --------------------------------------------------------------------------------------+
+ * @descr       Columns are drawn at sweep position like on analog scope, every update
+ *              sends window of new columns and gap only:
+ *                SCOPE_STEP x SCOPE_PAGES + SCOPE_GAP x SCOPE_PAGES bytes at most
+ */
+
+// INCLUDE libraries
+#include "scope.h"
+
+// global variables
+uint8_t _scopeCol = 0;                                  // @var global - sweep position
+uint8_t _scopeCount = 0;                                // @var global - samples of column
+int16_t _scopeMin = INT16_MAX;                          // @var global - min of column
+int16_t _scopeMax = INT16_MIN;                          // @var global - max of column
+uint8_t _scopeTop[SCOPE_STEP];                          // @var global - top row of new columns
+uint8_t _scopeBottom[SCOPE_STEP];                       // @var global - bottom row of new columns
+uint8_t _scopeBlock[SCOPE_PAGES * SCOPE_BLOCK];         // @var global - view pages of new columns
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @brief   Row of sample - 0 top ... SCOPE_ROWS - 1 bottom
+ *
+ * @param   int16_t sample
+ *
+ * @return  uint8_t
+ */
+static uint8_t SCOPE_Row (int16_t sample)
+{
+  int16_t row = (SCOPE_ROWS / 2 - 1) - (sample >> SCOPE_SHIFT);
+
+  if (row < 0) {
+    return 0;                                           // clip top
+  }
+  if (row > SCOPE_ROWS - 1) {
+    return SCOPE_ROWS - 1;                              // clip bottom
+  }
+  return (uint8_t) row;
+}
+
+/**
+ * @brief   Send block - n columns of envelope and gap at sweep position
+ *
+ * @param   uint8_t n columns
+ *
+ * @return  uint8_t
+ */
+static uint8_t SCOPE_Send (uint8_t n)
+{
+  uint8_t * block = _scopeBlock;
+  uint8_t width = SCOPE_WIDTH - _scopeCol;              // columns till right border
+  uint8_t row;
+  uint8_t page;
+  uint8_t top;
+  uint8_t bottom;
+  uint8_t i;
+
+  if (width > n + SCOPE_GAP) {
+    width = n + SCOPE_GAP;                              // gap cut by right border
+  }
+  // render view pages of new columns
+  // ----------------------------------------------------------------------------------
+  for (page = 0; page < SCOPE_PAGES; page++) {
+    row = page << 3;                                    // first row of page
+    for (i = 0; i < width; i++) {
+      *block = 0x00;                                    // gap or out of envelope
+      if (i < n) {
+        top = _scopeTop[i];
+        bottom = _scopeBottom[i];
+        if ((bottom >= row) && (top <= row + 7)) {
+          top = (top > row) ? top - row : 0;            // first bit on page
+          bottom = (bottom < row + 7) ? bottom - row : 7; // last bit on page
+          *block = (0xff << top) & (0xff >> (7 - bottom));
+        }
+      }
+      block++;
+    }
+  }
+  // one window, one transaction
+  // ----------------------------------------------------------------------------------
+  return SSD1306_DrawBlock (SCOPE_X + _scopeCol, SCOPE_PAGE, width, SCOPE_PAGES, _scopeBlock);
+}
+
+/**
+ * +-----------------------------------------------------------------------------------+
+ * |== SCOPE FUNCTIONS ================================================================|
+ * +-----------------------------------------------------------------------------------+
+ */
+
+/**
+ * @brief   Init - clear view, start recording
+ *
+ * @param   uint16_t sample rate 8000 ... 48000 Hz
+ * @param   uint16_t input - 0 microphone / SM_LINE1 line in
+ *
+ * @return  uint8_t
+ */
+uint8_t SCOPE_Init (uint16_t rate, uint16_t input)
+{
+  uint8_t status = INIT_STATUS;
+  uint8_t i;
+
+  // clear view
+  // ----------------------------------------------------------------------------------
+  for (i = 0; i < sizeof(_scopeBlock); i++) {
+    _scopeBlock[i] = 0x00;
+  }
+  for (i = 0; i < SCOPE_WIDTH; i += SCOPE_BLOCK) {
+    status = SSD1306_DrawBlock (SCOPE_X + i, SCOPE_PAGE,
+                                (SCOPE_WIDTH - i > SCOPE_BLOCK) ? SCOPE_BLOCK : SCOPE_WIDTH - i,
+                                SCOPE_PAGES, _scopeBlock);
+    if (SSD1306_SUCCESS != status) {                    // check status
+      return status;                                    // error
+    }
+  }
+  _scopeCol = 0;
+  _scopeCount = 0;
+  _scopeMin = INT16_MAX;
+  _scopeMax = INT16_MIN;
+
+  // start recording
+  // ----------------------------------------------------------------------------------
+  VS1053_RecordStart (rate, input);
+
+  return SSD1306_SUCCESS;                               // success
+}
+
+/**
+ * @brief   Update - read waiting samples, max up to right border or SCOPE_STEP
+ *          columns, rest stays in buffer of VS1053 for next update
+ *
+ * @param   void
+ *
+ * @return  uint8_t
+ */
+uint8_t SCOPE_Update (void)
+{
+  uint8_t status = INIT_STATUS;
+  uint16_t words = VS1053_RecordWords ();               // samples waiting
+  uint8_t space = SCOPE_WIDTH - _scopeCol;              // columns till right border
+  uint8_t n = 0;
+  int16_t sample;
+
+  if (space > SCOPE_STEP) {
+    space = SCOPE_STEP;
+  }
+  // min/max envelope of decimated samples
+  // ----------------------------------------------------------------------------------
+  while (words-- && (n < space)) {
+    sample = VS1053_RecordRead ();
+    if (sample < _scopeMin) {
+      _scopeMin = sample;
+    }
+    if (sample > _scopeMax) {
+      _scopeMax = sample;
+    }
+    if (++_scopeCount == SCOPE_DECIMATE) {              // column complete
+      _scopeTop[n] = SCOPE_Row (_scopeMax);
+      _scopeBottom[n] = SCOPE_Row (_scopeMin);
+      n++;
+      _scopeCount = 0;
+      _scopeMin = INT16_MAX;
+      _scopeMax = INT16_MIN;
+    }
+  }
+  if (n == 0) {
+    return SSD1306_SUCCESS;                             // nothing new
+  }
+  // new columns
+  // ----------------------------------------------------------------------------------
+  status = SCOPE_Send (n);
+  _scopeCol += n;
+  if (_scopeCol >= SCOPE_WIDTH) {
+    _scopeCol = 0;                                      // sweep from left
+  }
+
+  return status;
+}
+
+/**
+ * @brief   Stop recording
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void SCOPE_Stop (void)
+{
+  VS1053_RecordStop ();
+}
@@ -0,0 +1,73 @@
+/**
+ * --------------------------------------------------------------------------------------+
+ * @brief       Scope - scrolling waveform of VS1053 recording on SSD1306
+ * --------------------------------------------------------------------------------------+
+ * @date        18.10.2026
+ * @file        scope.h
+ * @version     1.0
+ * @test        AVR Atmega328p
+ *
+ * @depend      vs1053.h, lcd/ssd1306.h
+ * --------------------------------------------------------------------------------------+
+ * @descr       Samples of linear PCM recording are read from SCI_HDAT0, every column
+ *              is min/max envelope of SCOPE_DECIMATE samples. New columns are rendered
+ *              into block of view pages only and sent in one window at sweep position,
+ *              followed by cleared gap, so the display keeps older columns itself.
+ *              Start line register scrolls rows, not columns, so it is not used.
+ * --------------------------------------------------------------------------------------+
+ * @usage       SCOPE_Init (8000, SM_LINE1);
+ *              while (1) { SCOPE_Update (); }
+ */
+
+#ifndef __SCOPE_H__
+#define __SCOPE_H__
+
+  // INCLUDE libraries
+  #include "vs1053.h"
+  #include "lcd/ssd1306.h"
+
+  // VIEW
+  // ---------------------------------------------------------------------------------------
+  #define SCOPE_X                 0     // first column of view
+  #define SCOPE_WIDTH             128   // columns of view
+  #define SCOPE_PAGE              4     // first page of view
+  #define SCOPE_PAGES             4     // pages of view
+  #define SCOPE_ROWS              (SCOPE_PAGES * 8)
+  #define SCOPE_SHIFT             11    // sample >> shift = rows from center, 16 - log2(rows)
+
+  // SWEEP
+  // ---------------------------------------------------------------------------------------
+  #define SCOPE_DECIMATE          32    // samples per column, 8 kHz -> 250 columns/s
+  #define SCOPE_STEP              8     // max new columns sent per update
+  #define SCOPE_GAP               2     // cleared columns ahead of sweep
+  #define SCOPE_BLOCK             (SCOPE_STEP + SCOPE_GAP)
+
+  /**
+   * @brief   Init - clear view, start recording
+   *
+   * @param   uint16_t sample rate 8000 ... 48000 Hz
+   * @param   uint16_t input - 0 microphone / SM_LINE1 line in
+   *
+   * @return  uint8_t
+   */
+  uint8_t SCOPE_Init (uint16_t, uint16_t);
+
+  /**
+   * @brief   Update - read waiting samples, send completed columns
+   *
+   * @param   void
+   *
+   * @return  uint8_t
+   */
+  uint8_t SCOPE_Update (void);
+
+  /**
+   * @brief   Stop recording
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void SCOPE_Stop (void);
+
+#endif
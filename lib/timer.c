@@ -0,0 +1,151 @@
+/**
+ * ---------------------------------------------------------------+
+ * @brief       Timer2 system tick
+ * ---------------------------------------------------------------+
+ * @date        18.10.2026
+ * @file        timer.c
+ * @version     1.0
+ * @test        AVR Atmega328p
+ *
+ * @depend      timer.h
+ * ---------------------------------------------------------------+
+ * @interface   Timer2 in CTC mode, compare interrupt
+ */
+
+// include libraries
+#include <util/atomic.h>
+#include "timer.h"
+
+volatile uint16_t _timerTicks = 0;                  // @var global - ms since init
+void (* volatile _timerHook) (void) = 0;            // @var global - called every tick
+volatile uint8_t _timerAsleep = 0;                  // @var global - CPU in TIMER_Idle
+volatile struct TIMER_Load _timerLoad = {0, 0};     // @var global - tick samples
+
+/**
+ * @desc    Timer Init - tick TIMER_HZ, interrupts enabled by caller
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void TIMER_Init (void)
+{
+  TIMER_OCR = TIMER_TOP;                            // 8 MHz / 64 / 125 = 1 kHz
+#if defined(TIMER_TCCRA)
+  TIMER_TCCRA = TIMER_CTC;                          // clear timer on compare
+  TIMER_TCCRB = TIMER_CLOCK;                        // start
+#else
+  TIMER_TCCRB = TIMER_CTC | TIMER_CLOCK;            // clear timer on compare, start
+#endif
+  TIMER_TIMSK |= TIMER_IE;                          // compare interrupt
+}
+
+/**
+ * @desc    Timer Ticks - ms since init, wraps after 65 s
+ *
+ * @param   void
+ *
+ * @return  uint16_t
+ */
+uint16_t TIMER_Ticks (void)
+{
+  uint16_t ticks;
+
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+    ticks = _timerTicks;                            // 16 bit read
+  }
+  return ticks;
+}
+
+/**
+ * @desc    Timer Set hook - called from interrupt every tick, keep it short
+ *
+ * @param   void (*)(void) - 0 none
+ *
+ * @return  void
+ */
+void TIMER_SetHook (void (*hook)(void))
+{
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+    _timerHook = hook;                              // 16 bit write
+  }
+}
+
+/**
+ * @desc    Timer Stamp - free running count of TIMER_PRESCALER clocks (8 us),
+ *          differences valid up to 65535 counts (524 ms)
+ *
+ * @param   void
+ *
+ * @return  uint16_t
+ */
+uint16_t TIMER_Stamp (void)
+{
+  uint16_t ticks;
+  uint8_t count;
+
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+    ticks = _timerTicks;
+    count = TIMER_TCNT;
+    if ((TIMER_TIFR & TIMER_OCF) && (count < (TIMER_TOP >> 1))) {
+      ticks++;                                      // compare match, tick not counted yet
+    }
+  }
+  return ticks * (uint16_t) (TIMER_TOP + 1) + count;
+}
+
+/**
+ * @desc    Timer Idle - idle sleep till next interrupt (timer, TWI, INT0 ...),
+ *          call with interrupts disabled after last check of wake condition,
+ *          returns with interrupts enabled
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void TIMER_Idle (void)
+{
+  set_sleep_mode (SLEEP_MODE_IDLE);                 // clocks of peripherals run
+  sleep_enable ();
+  _timerAsleep = 1;
+  sei ();                                           // next instruction still atomic
+  sleep_cpu ();                                     // no wake lost between check and sleep
+  sleep_disable ();
+  _timerAsleep = 0;
+}
+
+/**
+ * @desc    Timer Get load - samples since last call, counting restarts
+ *
+ * @param   struct TIMER_Load *
+ *
+ * @return  void
+ */
+void TIMER_GetLoad (struct TIMER_Load * load)
+{
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+    load->ticks = _timerLoad.ticks;
+    load->idle = _timerLoad.idle;
+    _timerLoad.ticks = 0;
+    _timerLoad.idle = 0;
+  }
+}
+
+/**
+ * @desc    Timer compare interrupt
+ *
+ * @param   TIMER_VECT
+ *
+ * @return  void
+ */
+ISR (TIMER_VECT)
+{
+  _timerTicks++;
+  _timerLoad.ticks++;
+  if (_timerAsleep) {
+    _timerLoad.idle++;                              // tick woke CPU from sleep
+  }
+  if (_timerHook) {
+    _timerHook ();
+  }
+}
@@ -0,0 +1,129 @@
+/**
+ * ---------------------------------------------------------------+
+ * @brief       Timer2 system tick
+ * ---------------------------------------------------------------+
+ * @date        18.10.2026
+ * @file        timer.h
+ * @version     1.0
+ * @test        AVR Atmega328p
+ *
+ * @depend      avr/io.h, avr/interrupt.h, avr/sleep.h
+ * ---------------------------------------------------------------+
+ * @interface   Timer2 in CTC mode, compare interrupt
+ *
+ * @usage       TIMER_Init ();
+ *              TIMER_SetHook (VS1053_FadeTick);
+ *              sei ();
+ *
+ *              Every tick samples if CPU sleeps in TIMER_Idle, ratio of idle
+ *              to all samples is fraction of time in sleep (TIMER_GetLoad).
+ */
+
+#ifndef __TIMER_H__
+#define __TIMER_H__
+
+  // includes
+  #include <avr/io.h>
+  #include <avr/interrupt.h>
+  #include <avr/sleep.h>
+
+  // tick
+  #define TIMER_HZ            1000UL    // 1 ms tick
+  #define TIMER_PRESCALER     64UL
+  #define TIMER_TOP           ((F_CPU / TIMER_PRESCALER / TIMER_HZ) - 1)
+
+  // atmega328p
+  #if defined(__AVR_ATmega328P__)
+
+    #define TIMER_TCCRA       TCCR2A
+    #define TIMER_TCCRB       TCCR2B
+    #define TIMER_OCR         OCR2A
+    #define TIMER_TIMSK       TIMSK2
+    #define TIMER_TCNT        TCNT2
+    #define TIMER_TIFR        TIFR2
+    #define TIMER_OCF         (1 << OCF2A)
+    #define TIMER_CTC         (1 << WGM21)                // TCCR2A
+    #define TIMER_CLOCK       (1 << CS22)                 // TCCR2B, clk/64
+    #define TIMER_IE          (1 << OCIE2A)
+    #define TIMER_VECT        TIMER2_COMPA_vect
+
+  // atmega16
+  #elif defined(__AVR_ATmega16__)
+
+    #define TIMER_TCCRB       TCCR2
+    #define TIMER_OCR         OCR2
+    #define TIMER_TIMSK       TIMSK
+    #define TIMER_TCNT        TCNT2
+    #define TIMER_TIFR        TIFR
+    #define TIMER_OCF         (1 << OCF2)
+    #define TIMER_CTC         (1 << WGM21)                // TCCR2
+    #define TIMER_CLOCK       (1 << CS22)                 // TCCR2, clk/64
+    #define TIMER_IE          (1 << OCIE2)
+    #define TIMER_VECT        TIMER2_COMP_vect
+
+  #endif
+
+  // @struct Load - tick samples since last read
+  struct TIMER_Load {
+    uint16_t ticks;                   // all samples
+    uint16_t idle;                    // samples in idle sleep
+  };
+
+  /**
+   * @desc    Timer Init - tick TIMER_HZ, interrupts enabled by caller
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void TIMER_Init (void);
+
+  /**
+   * @desc    Timer Ticks - ms since init, wraps after 65 s
+   *
+   * @param   void
+   *
+   * @return  uint16_t
+   */
+  uint16_t TIMER_Ticks (void);
+
+  /**
+   * @desc    Timer Set hook - called from interrupt every tick, keep it short
+   *
+   * @param   void (*)(void) - 0 none
+   *
+   * @return  void
+   */
+  void TIMER_SetHook (void (*)(void));
+
+  /**
+   * @desc    Timer Stamp - free running count of TIMER_PRESCALER clocks (8 us),
+   *          differences valid up to 65535 counts (524 ms)
+   *
+   * @param   void
+   *
+   * @return  uint16_t
+   */
+  uint16_t TIMER_Stamp (void);
+
+  /**
+   * @desc    Timer Idle - idle sleep till next interrupt (timer, TWI, INT0 ...),
+   *          call with interrupts disabled after last check of wake condition,
+   *          returns with interrupts enabled
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void TIMER_Idle (void);
+
+  /**
+   * @desc    Timer Get load - samples since last call, counting restarts
+   *
+   * @param   struct TIMER_Load *
+   *
+   * @return  void
+   */
+  void TIMER_GetLoad (struct TIMER_Load *);
+
+#endif
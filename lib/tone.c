@@ -0,0 +1,138 @@
+/**
+ * --------------------------------------------------------------------------------------+
+ * @brief       Tone - VS1053 sine generator, tone switch without reset, beep sequences
+ * --------------------------------------------------------------------------------------+
+ * @date        18.10.2026
+ * @file        tone.c
+ * @version     1.0
+ * @test        AVR Atmega328p
+ *
+ * @depend      tone.h
+ * --------------------------------------------------------------------------------------+
+ */
+
+// INCLUDE libraries
+#include "tone.h"
+
+// global variables
+uint8_t _toneOn = 0;                                    // @var global - sine runs
+uint8_t _toneTests = 0;                                 // @var global - SM_TESTS set
+uint16_t _toneMode = 0;                                 // @var global - SCI_MODE before tests
+const struct TONE_Step * _toneSeq = 0;                  // @var global - step of sequence
+uint16_t _toneDue = 0;                                  // @var global - tick of next step
+
+// sine test exit sequence
+const uint8_t _sineExit[] PROGMEM = {0x45, 0x78, 0x69, 0x74, 0, 0, 0, 0};
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @brief   Sine - running one exited, next started without reset
+ *
+ * @param   uint8_t code, TONE_PAUSE silence
+ *
+ * @return  void
+ */
+static void TONE_Sine (uint8_t code)
+{
+  uint8_t sequence[8] = {0x53, 0xEF, 0x6E, code, 0, 0, 0, 0};
+  uint8_t exit[8];
+
+  if (_toneOn) {
+    memcpy_P (exit, _sineExit, 8);
+    VS1053_WriteSdi (exit, 8);                          // exit running sine
+    _toneOn = 0;
+  }
+  if (code == TONE_PAUSE) {
+    return;
+  }
+  if (!_toneTests) {
+    _toneMode = VS1053_ReadSci (SCI_MODE);
+    VS1053_WriteSci (SCI_MODE, _toneMode | SM_TESTS);   // allow SDI tests
+    _toneTests = 1;
+  }
+  VS1053_WriteSdi (sequence, 8);                        // start sine
+  _toneOn = 1;
+}
+
+/**
+ * +-----------------------------------------------------------------------------------+
+ * |== TONE FUNCTIONS =================================================================|
+ * +-----------------------------------------------------------------------------------+
+ */
+
+/**
+ * @brief   Start tone or switch to other one, sequence stopped
+ *
+ * @param   uint8_t VS10XX_SINE (Hz) / VS10XX_SINE_CODE (Hz)
+ *
+ * @return  void
+ */
+void TONE_Start (uint8_t code)
+{
+  _toneSeq = 0;
+  TONE_Sine (code);
+}
+
+/**
+ * @brief   Stop tone and sequence, decoder back in normal mode
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void TONE_Stop (void)
+{
+  _toneSeq = 0;
+  TONE_Sine (TONE_PAUSE);
+  if (_toneTests) {
+    VS1053_WriteSci (SCI_MODE, _toneMode);              // tests off
+    _toneTests = 0;
+  }
+}
+
+/**
+ * @brief   Play sequence in PROGMEM, non-blocking, TONE_Update times steps
+ *
+ * @param   const struct TONE_Step *
+ *
+ * @return  void
+ */
+void TONE_Play (const struct TONE_Step * sequence)
+{
+  _toneSeq = sequence;
+  _toneDue = TIMER_Ticks ();                            // first step now
+  TONE_Update ();
+}
+
+/**
+ * @brief   Update - next step of sequence when due, call from main loop or task
+ *
+ * @param   void
+ *
+ * @return  uint8_t 1 sequence runs / 0 done
+ */
+uint8_t TONE_Update (void)
+{
+  uint16_t ms;
+
+  if (!_toneSeq) {
+    return 0;
+  }
+  if ((int16_t) (TIMER_Ticks () - _toneDue) < 0) {
+    return 1;                                           // step plays
+  }
+  ms = pgm_read_word (&_toneSeq->ms);
+  if (!ms) {
+    TONE_Stop ();                                       // end of sequence
+    return 0;
+  }
+  TONE_Sine (pgm_read_byte (&_toneSeq->code));
+  _toneDue += ms;                                       // no drift
+  _toneSeq++;
+  return 1;
+}
@@ -0,0 +1,85 @@
+/**
+ * --------------------------------------------------------------------------------------+
+ * @brief       Tone - VS1053 sine generator, tone switch without reset, beep sequences
+ * --------------------------------------------------------------------------------------+
+ * @date        18.10.2026
+ * @file        tone.h
+ * @version     1.0
+ * @test        AVR Atmega328p
+ *
+ * @depend      vs1053.h, timer.h
+ * --------------------------------------------------------------------------------------+
+ * @descr       Sine test of decoder (SM_TESTS), no stream can play meanwhile. Tone is
+ *              switched by exit and start sequence, 16 bytes of SDI ~ 0.2 ms, no
+ *              reset. Sequence steps are timed by TIMER_Ticks in TONE_Update.
+ * --------------------------------------------------------------------------------------+
+ * @usage       TONE_Start (VS10XX_SINE (1000));                // 1 kHz, code folded
+ *              TONE_Play (TONE_OK);
+ *              while (TONE_Update ()) { ... }
+ */
+
+#ifndef __TONE_H__
+#define __TONE_H__
+
+  // INCLUDE libraries
+  #include <avr/pgmspace.h>
+  #include "vs1053.h"
+  #include "timer.h"
+
+  // Settings
+  #define TONE_PAUSE              0       // code of silent step
+
+  // @struct Step of sequence, ms 0 ends sequence
+  struct TONE_Step {
+    uint8_t code;                                 // VS10XX_SINE (Hz) or TONE_PAUSE
+    uint16_t ms;                                  // duration
+  };
+
+  // @const Sequences
+  static const struct TONE_Step TONE_CLICK[] PROGMEM = {
+    {VS10XX_SINE (2000), 15}, {0, 0}
+  };
+  static const struct TONE_Step TONE_OK[] PROGMEM = {
+    {VS10XX_SINE (1000), 60}, {TONE_PAUSE, 20}, {VS10XX_SINE (1500), 80}, {0, 0}
+  };
+  static const struct TONE_Step TONE_ERROR[] PROGMEM = {
+    {VS10XX_SINE (400), 120}, {TONE_PAUSE, 60}, {VS10XX_SINE (400), 120}, {0, 0}
+  };
+
+  /**
+   * @brief   Start tone or switch to other one, sequence stopped
+   *
+   * @param   uint8_t VS10XX_SINE (Hz) / VS10XX_SINE_CODE (Hz)
+   *
+   * @return  void
+   */
+  void TONE_Start (uint8_t);
+
+  /**
+   * @brief   Stop tone and sequence, decoder back in normal mode
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void TONE_Stop (void);
+
+  /**
+   * @brief   Play sequence in PROGMEM, non-blocking, TONE_Update times steps
+   *
+   * @param   const struct TONE_Step *
+   *
+   * @return  void
+   */
+  void TONE_Play (const struct TONE_Step *);
+
+  /**
+   * @brief   Update - next step of sequence when due, call from main loop or task
+   *
+   * @param   void
+   *
+   * @return  uint8_t 1 sequence runs / 0 done
+   */
+  uint8_t TONE_Update (void);
+
+#endif
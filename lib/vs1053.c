@@ -27,9 +27,18 @@
 // INCLUDE libraries
 #include "vs1053.h"
 #include "vs1053_info.h"
+#include <util/atomic.h>
+#if defined(VS1053_SLEEP)
+  #include "timer.h"
+#endif
 
 // global variables
-char buffer[VERS_TEXT_LEN];
+struct VS1053_Dev _vsDefault = VS1053_DEVICE (VS1053_PORT_XCS, VS1053_XCS,
+                                              VS1053_PORT_XDCS, VS1053_XDCS,
+                                              VS1053_PORT_XRES, VS1053_XRES,
+                                              VS1053_PIN_DREQ, VS1053_DREQ);  // @var global - pins above
+struct VS1053_Dev * _vsDev = &_vsDefault;              // @var global - selected device
+struct VS1053_Dev * volatile _vsList = 0;              // @var global - attached devices
 
 /**
  * +------------------------------------------------------------------------------------+
@@ -38,22 +47,228 @@ char buffer[VERS_TEXT_LEN];
  */
 
 /* Activate Command / clear XCS */
-static inline void VS1053_ActivateCommand (void) { VS1053_PORT_XCS &= ~(1 << VS1053_XCS); }
+static inline void VS1053_ActivateCommand (void) { *_vsDev->xcs &= ~_vsDev->xcs_mask; }
 /* Deactivate Command / set XCS */
-static inline void VS1053_DeactivateCommand (void) { VS1053_PORT_XCS |= (1 << VS1053_XCS); }
+static inline void VS1053_DeactivateCommand (void) { *_vsDev->xcs |= _vsDev->xcs_mask; }
 
 /* Activate Data / clear XDCS */
-static inline void VS1053_ActivateData (void) { VS1053_PORT_XDCS &= ~(1 << VS1053_XDCS); }
+static inline void VS1053_ActivateData (void) { *_vsDev->xdcs &= ~_vsDev->xdcs_mask; }
 /* Deactivate Data / set XDCS */
-static inline void VS1053_DeactivateData (void) { VS1053_PORT_XDCS |= (1 << VS1053_XDCS); }
+static inline void VS1053_DeactivateData (void) { *_vsDev->xdcs |= _vsDev->xdcs_mask; }
 
 /* Activate RESET / clear XRST */
-static inline void VS1053_ActivateReset (void) { VS1053_PORT_XRES &= ~(1 << VS1053_XRES); }
+static inline void VS1053_ActivateReset (void) { *_vsDev->xres &= ~_vsDev->xres_mask; }
 /* Deactivate RESET / set XRST */
-static inline void VS1053_DeactivateReset (void) { VS1053_PORT_XRES |= (1 << VS1053_XRES); }
+static inline void VS1053_DeactivateReset (void) { *_vsDev->xres |= _vsDev->xres_mask; }
 
+#if defined(VS1053_SLEEP)
+/**
+ * @brief   DREQ Wait - idle sleep, wake on INT0 edge of default device or on next
+ *          interrupt (timer, TWI); busy loop if interrupts are disabled
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void VS1053_DreqWait (void)
+{
+  if (!(SREG & (1 << SREG_I))) {
+    while (!(*_vsDev->dreq & _vsDev->dreq_mask));      // no wake without interrupts
+    return;
+  }
+  while (1) {
+    cli ();
+    if (_vsDev == &_vsDefault) {
+      VS1053_EIFR = (1 << INTF0);                       // clear old edge, then arm
+      VS1053_EIMSK |= (1 << INT0);                      // wake on rising DREQ
+    }
+    if (*_vsDev->dreq & _vsDev->dreq_mask) {            // edge after arm is kept
+      VS1053_EIMSK &= ~(1 << INT0);
+      sei ();
+      return;                                           // DREQ high
+    }
+    TIMER_Idle ();                                      // sei & sleep
+  }
+}
+
+/**
+ * @brief   DREQ interrupt - wake only, disabled until next wait
+ *
+ * @param   INT0_vect
+ *
+ * @return  void
+ */
+ISR (INT0_vect)
+{
+  VS1053_EIMSK &= ~(1 << INT0);
+}
+#else
 /* DREQ Wait */
-static inline void VS1053_DreqWait (void) { while (!(VS1053_PIN_DREQ & (1 << VS1053_DREQ))); }
+static inline void VS1053_DreqWait (void) { while (!(*_vsDev->dreq & _vsDev->dreq_mask)); }
+#endif
+
+/**
+ * @brief   Post SCI write to device
+ *
+ * @param   struct VS1053_Dev *
+ * @param   uint8_t addr
+ * @param   uint16_t value
+ *
+ * @return  uint8_t 1 posted / 0 full
+ */
+static uint8_t VS1053_PostSciDev (struct VS1053_Dev * dev, uint8_t addr, uint16_t value)
+{
+  uint8_t i;
+
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+    for (i = 0; i < dev->sciCount; i++) {
+      if (dev->sci[i].addr == addr) {                   // same register pending?
+        dev->sci[i].value = value;                      // latest value wins
+        return 1;
+      }
+    }
+    if (dev->sciCount < VS1053_SCI_PENDING) {
+      dev->sci[dev->sciCount].addr = addr;
+      dev->sci[dev->sciCount].value = value;
+      dev->sciCount++;
+      return 1;
+    }
+  }
+  return 0;                                             // full
+}
+
+/**
+ * @brief   Fade step of device, 1 ms
+ *
+ * @param   struct VS1053_Dev *
+ *
+ * @return  void
+ */
+static void VS1053_FadeStep (struct VS1053_Dev * dev)
+{
+  struct VS1053_Fade * fade = &dev->fade;
+  uint8_t changed = 0;
+  uint16_t steps;
+  uint8_t gap;
+  uint8_t ch;
+
+  if (!fade->ticks) {
+    return;                                             // no fade
+  }
+  for (ch = 0; ch < 2; ch++) {
+    fade->err[ch] += fade->diff[ch];
+    if (fade->err[ch] < fade->span) {
+      continue;                                         // no step due
+    }
+    // several steps at once if fade is shorter than change, no loop in interrupt
+    // --------------------------------------------------------------------------------
+    steps = fade->err[ch] / fade->span;
+    fade->err[ch] -= steps * fade->span;
+    if (fade->current[ch] < fade->target[ch]) {
+      gap = fade->target[ch] - fade->current[ch];
+      fade->current[ch] += (steps > gap) ? gap : (uint8_t) steps;   // quieter by 0.5 dB steps
+    } else {
+      gap = fade->current[ch] - fade->target[ch];
+      fade->current[ch] -= (steps > gap) ? gap : (uint8_t) steps;   // louder by 0.5 dB steps
+    }
+    changed = 1;
+  }
+  if (--fade->ticks == 0) {                             // end of fade
+    changed |= (fade->current[0] != fade->target[0]) || (fade->current[1] != fade->target[1]);
+    fade->current[0] = fade->target[0];
+    fade->current[1] = fade->target[1];
+  }
+  if (changed) {
+    VS1053_PostSciDev (dev, SCI_VOL, ((uint16_t) fade->current[0] << 8) | fade->current[1]);
+  }
+}
+
+/**
+ * @brief   Fade start - targets from volume, balance and mute, called out of interrupt
+ *
+ * @param   uint16_t ms
+ *
+ * @return  void
+ */
+static void VS1053_FadeStart (uint16_t ms)
+{
+  struct VS1053_Fade * fade = &_vsDev->fade;
+  int8_t balance = _vsDev->volBalance;
+  uint16_t target[2];
+  uint8_t ch;
+
+  target[0] = _vsDev->volMaster + ((balance > 0) ? balance : 0);
+  target[1] = _vsDev->volMaster + ((balance < 0) ? -balance : 0);
+
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+    for (ch = 0; ch < 2; ch++) {
+      if (_vsDev->volMute || (target[ch] > VS10XX_VOL_MUTE)) {
+        target[ch] = VS10XX_VOL_MUTE;                   // silence
+      }
+      fade->target[ch] = target[ch];
+      fade->diff[ch] = (fade->current[ch] > target[ch]) ? fade->current[ch] - target[ch]
+                                                        : target[ch] - fade->current[ch];
+      fade->err[ch] = 0;
+    }
+    fade->span = (ms == 0) ? 1 : ((ms > VS10XX_FADE_MAX) ? VS10XX_FADE_MAX : ms);
+    fade->ticks = fade->span;                           // first step at next tick
+  }
+}
+
+/**
+ * +-----------------------------------------------------------------------------------+
+ * |== DEVICE FUNCTIONS ===============================================================|
+ * +-----------------------------------------------------------------------------------+
+ */
+
+/**
+ * @brief   Attach device - pins as outputs deselected, device joins fade ticks;
+ *          attach all devices before first Init, selects stay high on shared bus
+ *
+ * @param   struct VS1053_Dev *
+ *
+ * @return  void
+ */
+void VS1053_Attach (struct VS1053_Dev * dev)
+{
+  VS1053_DDR_OF_PORT (dev->xres) |= dev->xres_mask;    // RESET as output
+  VS1053_DDR_OF_PORT (dev->xdcs) |= dev->xdcs_mask;    // DATA SELECT as output
+  VS1053_DDR_OF_PORT (dev->xcs) |= dev->xcs_mask;      // CHIP SELECT as output
+  *dev->xdcs |= dev->xdcs_mask;                         // set xDCS
+  *dev->xcs |= dev->xcs_mask;                           // set xCS
+
+  VS1053_DDR_OF_PIN (dev->dreq) &= ~dev->dreq_mask;     // DATA REQUEST as input
+  VS1053_PORT_OF_PIN (dev->dreq) |= dev->dreq_mask;     // DATA REQUEST pullup activate
+
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+    dev->next = _vsList;                                // fade ticks
+    _vsList = dev;
+  }
+}
+
+/**
+ * @brief   Select device for next calls, default device on pins above
+ *
+ * @param   struct VS1053_Dev *
+ *
+ * @return  void
+ */
+void VS1053_Select (struct VS1053_Dev * dev)
+{
+  _vsDev = dev;
+}
+
+/**
+ * @brief   Selected device
+ *
+ * @param   void
+ *
+ * @return  struct VS1053_Dev *
+ */
+struct VS1053_Dev * VS1053_Selected (void)
+{
+  return _vsDev;
+}
 
 /**
  * +-----------------------------------------------------------------------------------+
@@ -124,6 +339,7 @@ void VS1053_WriteSdi (const uint8_t * data, uint16_t n)
       n--;                                              // decrement
     }
     VS1053_DeactivateData ();                           // set xDCS
+    VS1053_ServiceSci ();                               // SCI writes between bursts
   }
   VS1053_DreqWait ();                                   // wait until DREQ is high
 }
@@ -150,10 +366,154 @@ void VS1053_WriteSdiByte (uint8_t byte, uint16_t n)
       n--;
     }
     VS1053_DeactivateData ();                           // set xDCS
+    VS1053_ServiceSci ();                               // SCI writes between bursts
   }
   VS1053_DreqWait ();                                   // wait until DREQ is high
 }
 
+/**
+ * @brief   Write Serial Data / one burst, DREQ must be high
+ *
+ * @param   const uint8_t * data
+ * @param   uint8_t n -> 1 ... 32
+ *
+ * @return  void
+ */
+void VS1053_WriteBurst (const uint8_t * data, uint8_t n)
+{
+  VS1053_ActivateData ();                               // clear xDCS
+  while (n--) {
+    SPI_Transfer (*data++);                             // send data
+  }
+  VS1053_DeactivateData ();                             // set xDCS
+  VS1053_ServiceSci ();                                 // SCI writes between bursts
+}
+
+/**
+ * @brief   Data request - decoder accepts next burst of 32 bytes
+ *
+ * @param   void
+ *
+ * @return  uint8_t
+ */
+uint8_t VS1053_Ready (void)
+{
+  return (*_vsDev->dreq & _vsDev->dreq_mask) ? 1 : 0;
+}
+
+/**
+ * @brief   Wait for DREQ - idle sleep in VS1053_SLEEP mode, busy loop otherwise
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void VS1053_Wait (void)
+{
+  VS1053_DreqWait ();
+}
+
+/**
+ * @brief   Write RAM word
+ *
+ * @param   uint16_t addr
+ * @param   uint16_t value
+ *
+ * @return  void
+ */
+void VS1053_WriteWram (uint16_t addr, uint16_t value)
+{
+  VS1053_WriteSci (SCI_WRAMADDR, addr);                 // address
+  VS1053_WriteSci (SCI_WRAM, value);                    // value
+}
+
+/**
+ * @brief   Read RAM word
+ *
+ * @param   uint16_t addr
+ *
+ * @return  uint16_t
+ */
+uint16_t VS1053_ReadWram (uint16_t addr)
+{
+  VS1053_WriteSci (SCI_WRAMADDR, addr);                 // address
+  return VS1053_ReadSci (SCI_WRAM);                     // value
+}
+
+/**
+ * @brief   Load plugin - compressed VLSI format in PROGMEM: addr, n, n values,
+ *          n with bit 15 set -> next value written (n & 0x7FFF) times
+ *
+ * @param   const uint16_t * plugin
+ * @param   uint16_t words
+ *
+ * @return  void
+ */
+void VS1053_LoadPlugin (const uint16_t * plugin, uint16_t size)
+{
+  uint16_t i = 0;
+  uint16_t value;
+  uint16_t n;
+  uint8_t addr;
+
+  while (i < size) {
+    addr = (uint8_t) pgm_read_word (&plugin[i++]);
+    n = pgm_read_word (&plugin[i++]);
+    if (n & 0x8000) {
+      n &= 0x7FFF;                                      // run of one value
+      value = pgm_read_word (&plugin[i++]);
+      while (n--) {
+        VS1053_WriteSci (addr, value);
+      }
+    } else {
+      while (n--) {                                     // n values
+        VS1053_WriteSci (addr, pgm_read_word (&plugin[i++]));
+      }
+    }
+  }
+}
+
+/**
+ * @brief   Post SCI write - written at next gap between SDI bursts,
+ *          later value for the same register replaces pending one
+ *
+ * @param   uint8_t addr
+ * @param   uint16_t value
+ *
+ * @return  uint8_t 1 posted / 0 full
+ */
+uint8_t VS1053_PostSci (uint8_t addr, uint16_t value)
+{
+  return VS1053_PostSciDev (_vsDev, addr, value);
+}
+
+/**
+ * @brief   Service pending SCI writes - call only between SDI bursts,
+ *          every write takes 4 bytes of SPI without SDI FIFO
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void VS1053_ServiceSci (void)
+{
+  uint8_t addr;
+  uint16_t value;
+  uint8_t i;
+
+  while (_vsDev->sciCount) {
+    ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+      addr = _vsDev->sci[0].addr;                         // oldest write
+      value = _vsDev->sci[0].value;
+      for (i = 1; i < _vsDev->sciCount; i++) {
+        _vsDev->sci[i - 1] = _vsDev->sci[i];
+      }
+      _vsDev->sciCount--;
+    }
+    VS1053_WriteSci (addr, value);
+  }
+}
+
 /**
  * +-----------------------------------------------------------------------------------+
  * |== TEST FUNCTIONS =================================================================|
@@ -249,6 +609,36 @@ void VS1053_TestSine (uint8_t n)
   _delay_ms (100);                                      // delay
 }
 
+/**
+ * @brief   Sine code - closest FsIdx and skip at run time, VS10XX_SINE for constants
+ *
+ * @param   uint16_t Hz
+ *
+ * @return  uint8_t
+ */
+uint8_t VS1053_SineCode (uint16_t f)
+{
+  uint32_t best = 0xFFFFFFFF;
+  uint32_t err;
+  uint32_t fs;
+  uint32_t sine;
+  uint8_t code = 0;
+  uint8_t skip;
+  uint8_t i;
+
+  for (i = 0; i < 8; i++) {
+    fs = pgm_read_word (&vs10xx_fs[i]);
+    skip = (uint8_t) VS10XX_CLAMP ((((uint32_t) f << 7) + (fs >> 1)) / fs, 1, 31);
+    sine = fs * skip;                                   // f * 128
+    err = (sine > ((uint32_t) f << 7)) ? sine - ((uint32_t) f << 7) : ((uint32_t) f << 7) - sine;
+    if (err < best) {
+      best = err;
+      code = (i << 5) | skip;
+    }
+  }
+  return code;
+}
+
 /**
  * @brief   Memory Test
  *
@@ -299,8 +689,13 @@ uint16_t VS1053_TestSample (const char * sample, uint16_t n)
   VS1053_SoftReset ();                                  //
 
   while (i < n) {
-    while (!(VS1053_PORT_DREQ & (1 << VS1053_DREQ))) {  // DREQ wait
+    if (_vsDev->sciCount && !(i & 0x1F)) {              // gap between 32 bytes bursts
+      VS1053_DeactivateData ();                         // set xDCS
+      VS1053_ServiceSci ();                             // pending SCI writes
+    }
+    if (!VS1053_Ready ()) {                             // DREQ wait
       VS1053_DeactivateData ();                         // set xDCS
+      VS1053_DreqWait ();
     }
     VS1053_ActivateData ();                             // clear xDCS
     SPI_Transfer (pgm_read_byte(&sample[i++]));         // send data
@@ -327,12 +722,15 @@ uint16_t VS1053_TestSample (const char * sample, uint16_t n)
  */
 void VS1053_Init (void)
 {
-  VS1053_DDR_XRES |= (1 << VS1053_XRES);                // RESET as output
-  VS1053_DDR_XDCS |= (1 << VS1053_XDCS);                // DATA SELECT as output
-  VS1053_DDR_XCS |= (1 << VS1053_XCS);                  // CHIP SELECT as output
+  struct VS1053_Dev * dev;
 
-  VS1053_DDR_DREQ &= ~(1 << VS1053_DREQ);               // DATA REQUEST as input
-  VS1053_PORT_DREQ |= (1 << VS1053_DREQ);               // DATA REQUEST pullup activate
+  for (dev = _vsList; dev && (dev != _vsDev); dev = dev->next);
+  if (!dev) {
+    VS1053_Attach (_vsDev);                             // pins of selected device
+  }
+#if defined(VS1053_SLEEP)
+  VS1053_EICR |= (1 << ISC01) | (1 << ISC00);           // INT0 on rising edge
+#endif
 
   SPI_Init (SPI_MASTER |                                // Slow Speed Init
             SPI_MODE_0 | 
@@ -407,7 +805,7 @@ void VS1053_Reset (void)
 
   VS1053_SetVolume (0xfe,0xfe);                         // switch on the analog parts
   VS1053_WriteSci (SCI_AUDATA, 0x1F41);                 // 8kHz, mono
-  VS1053_SetVolume (0x66,0x66);                         // set volume level
+  VS1053_SetVolume (_vsDev->volMaster, _vsDev->volMaster); // set volume level
 
   VS1053_SoftReset();                                   // soft reset
 
@@ -461,9 +859,9 @@ char * VS1053_GetVersion (void)
   v >>= 4;                                              // read upper nibble
 
   p = (char *) pgm_read_word (&vs10xx_vers[v]);         // read version value
-  strcpy_P (buffer, p);                                 // copy content into buffer
+  strcpy_P (_vsDev->version, p);                        // copy content into buffer
 
-  return buffer;                                        // return string
+  return _vsDev->version;                               // return string
 }
 
 /**
@@ -481,8 +879,7 @@ uint16_t VS1053_PlayCancel (void)
 
   // read extra parameter - endFillByte
   // ----------------------------------------------------------------------------------
-  VS1053_WriteSci (SCI_WRAMADDR, VS10XX_ADDR_ENDBYTE);
-  endbyte = (uint8_t) VS1053_ReadSci (SCI_WRAM) & 0xff;
+  endbyte = (uint8_t) VS1053_ReadWram (VS10XX_ADDR_ENDBYTE) & 0xff;
 
   // send at least 2052 bytes of endFillByte
   // ----------------------------------------------------------------------------------
@@ -526,5 +923,257 @@ uint16_t VS1053_PlayCancel (void)
 void VS1053_SetVolume (uint8_t left, uint8_t right)
 {
   uint16_t volume = (left << 8) | right;                // set volume integer
-  VS1053_WriteSci (SCI_VOL, volume);                    // send command
-}
\ No newline at end of file
+
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+    _vsDev->fade.current[0] = _vsDev->fade.target[0] = left;  // fade stopped
+    _vsDev->fade.current[1] = _vsDev->fade.target[1] = right;
+    _vsDev->fade.ticks = 0;
+  }
+  VS1053_ServiceSci ();                                 // free slots of pending writes
+  VS1053_PostSci (SCI_VOL, volume);                     // replaces pending fade step
+  VS1053_ServiceSci ();                                 // send command
+}
+
+/**
+ * @brief   Fade volume - both channels, balance kept
+ *
+ * @param   uint8_t attenuation 0 ... 0xFE in 0.5 dB
+ * @param   uint16_t ms
+ *
+ * @return  void
+ */
+void VS1053_FadeVolume (uint8_t volume, uint16_t ms)
+{
+  _vsDev->volMaster = volume;
+  VS1053_FadeStart (ms);
+}
+
+/**
+ * @brief   Fade balance
+ *
+ * @param   int8_t 0.5 dB, > 0 attenuates left, < 0 attenuates right
+ * @param   uint16_t ms
+ *
+ * @return  void
+ */
+void VS1053_SetBalance (int8_t balance, uint16_t ms)
+{
+  _vsDev->volBalance = (balance == -128) ? -127 : balance;  // symmetric range
+  VS1053_FadeStart (ms);
+}
+
+/**
+ * @brief   Soft mute - fade to silence
+ *
+ * @param   uint16_t ms
+ *
+ * @return  void
+ */
+void VS1053_Mute (uint16_t ms)
+{
+  _vsDev->volMute = 1;
+  VS1053_FadeStart (ms);
+}
+
+/**
+ * @brief   Soft unmute - fade back to volume and balance
+ *
+ * @param   uint16_t ms
+ *
+ * @return  void
+ */
+void VS1053_Unmute (uint16_t ms)
+{
+  _vsDev->volMute = 0;
+  VS1053_FadeStart (ms);
+}
+
+/**
+ * @brief   Fade in progress
+ *
+ * @param   void
+ *
+ * @return  uint8_t
+ */
+uint8_t VS1053_FadeBusy (void)
+{
+  uint8_t busy;
+
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+    busy = (_vsDev->fade.ticks != 0);
+  }
+  return busy;
+}
+
+/**
+ * @brief   Fade tick - 1 ms, hook of timer interrupt (TIMER_SetHook). New level is
+ *          posted, not written; it goes out at next gap between SDI bursts, while
+ *          not streaming main loop has to call VS1053_ServiceSci.
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void VS1053_FadeTick (void)
+{
+  struct VS1053_Dev * dev;
+
+  if (!_vsList) {
+    VS1053_FadeStep (_vsDev);                           // single device, not attached
+  }
+  for (dev = _vsList; dev; dev = dev->next) {
+    VS1053_FadeStep (dev);
+  }
+}
+
+/**
+ * @brief   Get decode time - full seconds of stream decoded since reset or since
+ *          SCI_DECODE_TIME was written, cleared by soft reset
+ *
+ * @param   void
+ *
+ * @return  uint16_t seconds
+ */
+uint16_t VS1053_GetDecodeTime (void)
+{
+  return VS1053_ReadSci (SCI_DECODE_TIME);              // read decode time
+}
+
+/**
+ * @brief   Set decode time - written twice, decoder may overwrite first write
+ *
+ * @param   uint16_t seconds
+ *
+ * @return  void
+ */
+void VS1053_SetDecodeTime (uint16_t seconds)
+{
+  VS1053_WriteSci (SCI_DECODE_TIME, seconds);
+  VS1053_WriteSci (SCI_DECODE_TIME, seconds);
+}
+
+/**
+ * @brief   Set play speed - fast forward without jumps, decoder takes data
+ *          n-times faster, feed has to keep up: 320 kbit/s x 4 = 160 kB/s
+ *
+ * @param   uint16_t 1 normal, 2 double ...
+ *
+ * @return  void
+ */
+void VS1053_SetPlaySpeed (uint16_t speed)
+{
+  VS1053_WriteWram (VS10XX_ADDR_PLAYSPEED, speed);
+}
+
+/**
+ * @brief   Jump allowed - SS_DO_NOT_JUMP clear, set while header is decoded
+ *
+ * @param   void
+ *
+ * @return  uint8_t
+ */
+uint8_t VS1053_CanJump (void)
+{
+  return (VS1053_ReadSci (SCI_STATUS) & (1U << SS_DO_NOT_JUMP)) ? 0 : 1;
+}
+
+/**
+ * @brief   Record start - linear PCM, left channel as mono, one word per sample
+ *          in buffer of 1024 words, read through SCI_HDAT0
+ *
+ * @param   uint16_t sample rate 8000 ... 48000 Hz
+ * @param   uint16_t input - 0 microphone / SM_LINE1 line in
+ *
+ * @return  void
+ */
+void VS1053_RecordStart (uint16_t rate, uint16_t input)
+{
+  VS1053_WriteSci (SCI_AICTRL0, rate);                  // sample rate
+  VS1053_WriteSci (SCI_AICTRL1, VS10XX_REC_AGC);        // automatic gain
+  VS1053_WriteSci (SCI_AICTRL2, VS10XX_REC_AGC_MAX);    // max gain of AGC
+  VS1053_WriteSci (SCI_AICTRL3, VS10XX_REC_LINEAR | VS10XX_REC_LEFT);
+
+  // recording starts after soft reset with SM_ADPCM set
+  // ----------------------------------------------------------------------------------
+  VS1053_WriteSci (SCI_MODE, SM_SDINEW | SM_RESET | SM_ADPCM | (input & SM_LINE1));
+  _delay_ms (1);                                        // delay
+  VS1053_DreqWait ();                                   // wait until DREQ is high
+}
+
+/**
+ * @brief   Record words waiting in buffer - over 896 words buffer is about to overflow
+ *
+ * @param   void
+ *
+ * @return  uint16_t
+ */
+uint16_t VS1053_RecordWords (void)
+{
+  return VS1053_ReadSci (SCI_HDAT1);                    // words in buffer
+}
+
+/**
+ * @brief   Record read sample - read only if VS1053_RecordWords is not zero
+ *
+ * @param   void
+ *
+ * @return  int16_t
+ */
+int16_t VS1053_RecordRead (void)
+{
+  return (int16_t) VS1053_ReadSci (SCI_HDAT0);          // oldest word of buffer
+}
+
+/**
+ * @brief   Record stop - soft reset clears SM_ADPCM
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void VS1053_RecordStop (void)
+{
+  VS1053_SoftReset ();                                  // soft reset
+}
+
+/**
+ * @brief   Set bass and treble enhancer - one posted SCI write, safe from interrupt,
+ *          written at next gap between SDI bursts or by VS1053_ServiceSci
+ *
+ * @param   uint16_t SCI_BASS - VS10XX_BASS_PACK (treble dB, Hz, bass dB, Hz)
+ *
+ * @return  uint8_t 1 posted / 0 full
+ */
+uint8_t VS1053_SetBass (uint16_t bass)
+{
+  return VS1053_PostSci (SCI_BASS, bass);               // replaces pending value
+}
+
+/**
+ * @brief   Set bass and treble enhancer now - main context only, pending writes
+ *          are flushed first so the post always finds a free slot
+ *
+ * @param   uint16_t SCI_BASS - VS10XX_BASS_PACK (treble dB, Hz, bass dB, Hz)
+ *
+ * @return  void
+ */
+void VS1053_SetBassNow (uint16_t bass)
+{
+  VS1053_ServiceSci ();                                 // free slots
+  VS1053_PostSci (SCI_BASS, bass);
+  VS1053_ServiceSci ();                                 // write now
+}
+
+/**
+ * @brief   Set bass and treble enhancer preset - main context only
+ *
+ * @param   enum E_Bass
+ *
+ * @return  void
+ */
+void VS1053_SetBassPreset (enum E_Bass preset)
+{
+  if (preset < VS10XX_PRESETS) {
+    VS1053_SetBassNow (pgm_read_word (&vs10xx_bass[preset]));
+  }
+}
@@ -62,6 +62,23 @@
   #define VS1053_PORT_DREQ        PORTD
   #define VS1053_DREQ             2
 
+  // Idle sleep while waiting for DREQ
+  // -------------------------------------------
+  // VS1053_SLEEP    - uncomment to sleep in DREQ waits, sei() and TIMER_Init required;
+  //                   default device wakes on INT0 (DREQ on PD2), others on timer tick
+//#define VS1053_SLEEP
+  #if defined(VS1053_SLEEP)
+    #if defined(__AVR_ATmega16__)
+      #define VS1053_EIMSK        GICR
+      #define VS1053_EIFR         GIFR
+      #define VS1053_EICR         MCUCR
+    #else
+      #define VS1053_EIMSK        EIMSK
+      #define VS1053_EIFR         EIFR
+      #define VS1053_EICR         EICRA
+    #endif
+  #endif
+
   // REGISTERS
   // ---------------------------------------------------------------------------------------
   #define SCI_MODE                0x0 // Mode control
@@ -122,11 +139,164 @@
   #define VS10XX_FREQ_5kHz        0x54
   // Settings
   #define VS10XX_CLOCKF_SET       0x8800
+  #define VS10XX_ADDR_PLAYSPEED   0x1E04 // parametric playSpeed, 0 / 1 normal, 2 double ...
+  #define VS10XX_ADDR_BYTERATE    0x1E05 // parametric byteRate, bytes per second of stream
   #define VS10XX_ADDR_ENDBYTE     0x1E06
+  // Recording, SCI_AICTRL3
+  #define VS10XX_REC_JOINT        0x0 // Joint stereo, common AGC
+  #define VS10XX_REC_DUAL         0x1 // Dual channel, separate AGC
+  #define VS10XX_REC_LEFT         0x2 // Left channel only
+  #define VS10XX_REC_RIGHT        0x3 // Right channel only
+  #define VS10XX_REC_LINEAR       0x4 // Linear PCM instead of IMA ADPCM
+  // Recording gain, SCI_AICTRL1 / SCI_AICTRL2 [1024 = 1x]
+  #define VS10XX_REC_AGC          0x0000 // automatic gain control
+  #define VS10XX_REC_AGC_MAX      0x1000 // max AGC gain 4x
+  // SCI_VOL, attenuation 0.5 dB per step
+  #define VS10XX_VOL_SET          0x66   // volume level after reset, -51 dB
+  #define VS10XX_VOL_MUTE         0xFE   // silence, -127 dB
+  #define VS10XX_FADE_MAX         60000  // longest fade in ms
+
+  // Pending SCI writes serviced between SDI bursts
+  #define VS1053_SCI_PENDING      4
+  // Version string length without terminating null
+  #define VERS_TEXT_LEN           6
+
+  // SCI_BASS
+  // ---------------------------------------------------------------------------------------
+  // | ST_AMPLITUDE 15:12 | ST_FREQLIMIT 11:8 | SB_AMPLITUDE 7:4 | SB_FREQLIMIT 3:0 |
+  // treble -8 ... 7 x 1.5 dB above 1 ... 15 kHz, bass 0 ... 15 dB below 20 ... 150 Hz,
+  // zero amplitude switches enhancer off
+  #define VS10XX_CLAMP(v, lo, hi) ((v) < (lo) ? (lo) : ((v) > (hi) ? (hi) : (v)))
+  #define VS10XX_TREBLE_STEP(db)  VS10XX_CLAMP ((((db) * 2) + (((db) < 0) ? -1 : 1)) / 3, -8, 7)
+  // Pack treble dB, treble Hz, bass dB, bass Hz, folded at compile time if constant
+  #define VS10XX_BASS_PACK(tdb, thz, bdb, bhz) \
+    ((uint16_t) (((uint16_t) (VS10XX_TREBLE_STEP (tdb) & 0x0F) << 12) | \
+                 ((uint16_t) VS10XX_CLAMP (((thz) + 500UL) / 1000, 0, 15) << 8) | \
+                 ((uint16_t) VS10XX_CLAMP ((bdb), 0, 15) << 4) | \
+                 ((uint16_t) VS10XX_CLAMP (((bhz) + 5UL) / 10, 0, 15))))
+
+  // Sine test code | FsIdx 7:5 | S 4:0 |, Fsine = Fs * S / 128 -> 86 ... 11625 Hz
+  // ---------------------------------------------------------------------------------------
+  #define VS10XX_FS_0             44100ULL
+  #define VS10XX_FS_1             48000ULL
+  #define VS10XX_FS_2             32000ULL
+  #define VS10XX_FS_3             22050ULL
+  #define VS10XX_FS_4             24000ULL
+  #define VS10XX_FS_5             16000ULL
+  #define VS10XX_FS_6             11025ULL
+  #define VS10XX_FS_7             12000ULL
+  // skip S for FsIdx i, rounded
+  #define VS10XX_SINE_S(f, i)     VS10XX_CLAMP ((((f) * 128ULL) + (VS10XX_FS_##i >> 1)) / VS10XX_FS_##i, 1, 31)
+  // key - squared error above code, smaller key is closer tone
+  #define VS10XX_SINE_DIFF(f, i)  ((long long) (VS10XX_FS_##i * VS10XX_SINE_S (f, i)) - (long long) ((f) * 128ULL))
+  #define VS10XX_SINE_KEY(f, i)   ((unsigned long long) (VS10XX_SINE_DIFF (f, i) * VS10XX_SINE_DIFF (f, i)) << 8 | \
+                                   ((i) << 5) | VS10XX_SINE_S (f, i))
+  #define VS10XX_SINE_MIN(a, b)   (((b) < (a)) ? (b) : (a))
+  // Closest sine test code to f Hz, folded at compile time if constant
+  #define VS10XX_SINE(f) \
+    ((uint8_t) (VS10XX_SINE_MIN (VS10XX_SINE_MIN (VS10XX_SINE_MIN (VS10XX_SINE_KEY (f, 0), VS10XX_SINE_KEY (f, 1)), \
+                                                  VS10XX_SINE_MIN (VS10XX_SINE_KEY (f, 2), VS10XX_SINE_KEY (f, 3))), \
+                                 VS10XX_SINE_MIN (VS10XX_SINE_MIN (VS10XX_SINE_KEY (f, 4), VS10XX_SINE_KEY (f, 5)), \
+                                                  VS10XX_SINE_MIN (VS10XX_SINE_KEY (f, 6), VS10XX_SINE_KEY (f, 7)))) & 0xFF))
+  // Sine test code of constant or run time frequency
+  #define VS10XX_SINE_CODE(f)     (__builtin_constant_p (f) ? VS10XX_SINE (f) : VS1053_SineCode (f))
+
+  // Presets of SCI_BASS in PROGMEM
+  enum E_Bass {
+    VS10XX_PRESET_FLAT = 0,
+    VS10XX_PRESET_BASS,
+    VS10XX_PRESET_TREBLE,
+    VS10XX_PRESET_LOUDNESS,
+    VS10XX_PRESET_SPEECH,
+    VS10XX_PRESETS
+  };
+
+  // @struct Pending SCI write
+  struct VS1053_Sci {
+    uint8_t addr;
+    uint16_t value;
+  };
+
+  // @struct Volume fade, steps of 0.5 dB spread over fade like line of Bresenham
+  struct VS1053_Fade {
+    uint8_t current[2];                           // attenuation left, right
+    uint8_t target[2];                            // attenuation at the end
+    uint8_t diff[2];                              // steps of fade
+    uint16_t err[2];                              // step accumulator
+    uint16_t span;                                // ms of fade
+    uint16_t ticks;                               // ms left
+  };
+
+  // @struct Device - pins and state of one codec, all codecs share SPI bus
+  struct VS1053_Dev {
+    volatile uint8_t * xcs;                       // PORT of XCS
+    uint8_t xcs_mask;
+    volatile uint8_t * xdcs;                      // PORT of XDCS
+    uint8_t xdcs_mask;
+    volatile uint8_t * xres;                      // PORT of XRST
+    uint8_t xres_mask;
+    volatile uint8_t * dreq;                      // PIN of DREQ
+    uint8_t dreq_mask;
+    char version[VERS_TEXT_LEN + 1];              // version string
+    volatile struct VS1053_Sci sci[VS1053_SCI_PENDING];
+    volatile uint8_t sciCount;                    // SCI writes waiting
+    struct VS1053_Fade fade;                      // volume fade
+    uint8_t volMaster;                            // volume of both channels
+    int8_t volBalance;                            // balance
+    uint8_t volMute;                              // soft mute
+    struct VS1053_Dev * next;                     // attached devices
+  };
+
+  // I/O space order of every port: PINx, DDRx, PORTx
+  #define VS1053_DDR_OF_PORT(port)  (*((port) - 1))
+  #define VS1053_DDR_OF_PIN(pin)    (*((pin) + 1))
+  #define VS1053_PORT_OF_PIN(pin)   (*((pin) + 2))
+
+  // Device initializer - PORT of XCS, XDCS, XRST and PIN of DREQ with bit numbers
+  #define VS1053_DEVICE(port_xcs, xcs, port_xdcs, xdcs, port_xres, xres, pin_dreq, dreq) \
+    { &(port_xcs), (1 << (xcs)), &(port_xdcs), (1 << (xdcs)), \
+      &(port_xres), (1 << (xres)), &(pin_dreq), (1 << (dreq)), \
+      {0}, {{0, 0}}, 0, {{0xFF, 0xFF}, {0xFF, 0xFF}, {0, 0}, {0, 0}, 1, 0}, \
+      VS10XX_VOL_SET, 0, 0, 0 }
+
   // Memory test ok
   #define VS1003_MEMTEST_OK       0x807f
   #define VS1053_MEMTEST_OK       0x83ff
 
+  /**
+   * +-----------------------------------------------------------------------------------+
+   * |== DEVICE FUNCTIONS ===============================================================|
+   * +-----------------------------------------------------------------------------------+
+   */
+
+  /**
+   * @brief   Attach device - pins as outputs deselected, device joins fade ticks;
+   *          attach all devices before first Init, selects stay high on shared bus
+   *
+   * @param   struct VS1053_Dev *
+   *
+   * @return  void
+   */
+  void VS1053_Attach (struct VS1053_Dev *);
+
+  /**
+   * @brief   Select device for next calls, default device on pins above
+   *
+   * @param   struct VS1053_Dev *
+   *
+   * @return  void
+   */
+  void VS1053_Select (struct VS1053_Dev *);
+
+  /**
+   * @brief   Selected device
+   *
+   * @param   void
+   *
+   * @return  struct VS1053_Dev *
+   */
+  struct VS1053_Dev * VS1053_Selected (void);
+
   /**
    * +-----------------------------------------------------------------------------------+
    * |== COMMUNICATION FUNCTIONS ========================================================|
@@ -172,6 +342,84 @@
    */
   void VS1053_WriteSdiByte (uint8_t, uint16_t);
 
+  /**
+   * @brief   Write Serial Data / one burst, DREQ must be high
+   *
+   * @param   const uint8_t * data
+   * @param   uint8_t n -> 1 ... 32
+   *
+   * @return  void
+   */
+  void VS1053_WriteBurst (const uint8_t *, uint8_t);
+
+  /**
+   * @brief   Data request - decoder accepts next burst of 32 bytes
+   *
+   * @param   void
+   *
+   * @return  uint8_t
+   */
+  uint8_t VS1053_Ready (void);
+
+  /**
+   * @brief   Wait for DREQ - idle sleep in VS1053_SLEEP mode, busy loop otherwise
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void VS1053_Wait (void);
+
+  /**
+   * @brief   Write RAM word
+   *
+   * @param   uint16_t addr
+   * @param   uint16_t value
+   *
+   * @return  void
+   */
+  void VS1053_WriteWram (uint16_t, uint16_t);
+
+  /**
+   * @brief   Read RAM word
+   *
+   * @param   uint16_t addr
+   *
+   * @return  uint16_t
+   */
+  uint16_t VS1053_ReadWram (uint16_t);
+
+  /**
+   * @brief   Load plugin - compressed VLSI format in PROGMEM: addr, n, n values,
+   *          n with bit 15 set -> next value written (n & 0x7FFF) times
+   *
+   * @param   const uint16_t * plugin
+   * @param   uint16_t words
+   *
+   * @return  void
+   */
+  void VS1053_LoadPlugin (const uint16_t *, uint16_t);
+
+  /**
+   * @brief   Post SCI write - written at next gap between SDI bursts,
+   *          later value for the same register replaces pending one
+   *
+   * @param   uint8_t addr
+   * @param   uint16_t value
+   *
+   * @return  uint8_t 1 posted / 0 full
+   */
+  uint8_t VS1053_PostSci (uint8_t, uint16_t);
+
+  /**
+   * @brief   Service pending SCI writes
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void VS1053_ServiceSci (void);
+
   /**
    * +-----------------------------------------------------------------------------------+
    * |== TEST FUNCTIONS =================================================================|
@@ -196,6 +444,15 @@
    */
   void VS1053_TestSine (uint8_t);
 
+  /**
+   * @brief   Sine code - closest FsIdx and skip at run time, VS10XX_SINE for constants
+   *
+   * @param   uint16_t Hz
+   *
+   * @return  uint8_t
+   */
+  uint8_t VS1053_SineCode (uint16_t);
+
   /**
    * @brief   Memory Test
    *
@@ -221,7 +478,7 @@
    */
 
   /**
-   * @brief   Init
+   * @brief   Init - selected device, attached if not yet
    *
    * @param   void
    *
@@ -277,4 +534,162 @@
    */
   void VS1053_SetVolume (uint8_t, uint8_t);
 
+  /**
+   * @brief   Fade volume - both channels, balance kept
+   *
+   * @param   uint8_t attenuation 0 ... 0xFE in 0.5 dB
+   * @param   uint16_t ms
+   *
+   * @return  void
+   */
+  void VS1053_FadeVolume (uint8_t, uint16_t);
+
+  /**
+   * @brief   Fade balance
+   *
+   * @param   int8_t 0.5 dB, > 0 attenuates left, < 0 attenuates right
+   * @param   uint16_t ms
+   *
+   * @return  void
+   */
+  void VS1053_SetBalance (int8_t, uint16_t);
+
+  /**
+   * @brief   Soft mute - fade to silence
+   *
+   * @param   uint16_t ms
+   *
+   * @return  void
+   */
+  void VS1053_Mute (uint16_t);
+
+  /**
+   * @brief   Soft unmute - fade back to volume and balance
+   *
+   * @param   uint16_t ms
+   *
+   * @return  void
+   */
+  void VS1053_Unmute (uint16_t);
+
+  /**
+   * @brief   Fade in progress
+   *
+   * @param   void
+   *
+   * @return  uint8_t
+   */
+  uint8_t VS1053_FadeBusy (void);
+
+  /**
+   * @brief   Fade tick - 1 ms, hook of timer interrupt (TIMER_SetHook), all devices
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void VS1053_FadeTick (void);
+
+  /**
+   * @brief   Get decode time
+   *
+   * @param   void
+   *
+   * @return  uint16_t seconds
+   */
+  uint16_t VS1053_GetDecodeTime (void);
+
+  /**
+   * @brief   Set decode time
+   *
+   * @param   uint16_t seconds
+   *
+   * @return  void
+   */
+  void VS1053_SetDecodeTime (uint16_t);
+
+  /**
+   * @brief   Set play speed - fast forward without jumps, decoder takes data
+   *          n-times faster
+   *
+   * @param   uint16_t 1 normal, 2 double ...
+   *
+   * @return  void
+   */
+  void VS1053_SetPlaySpeed (uint16_t);
+
+  /**
+   * @brief   Jump allowed - SS_DO_NOT_JUMP clear
+   *
+   * @param   void
+   *
+   * @return  uint8_t
+   */
+  uint8_t VS1053_CanJump (void);
+
+  /**
+   * @brief   Set bass and treble enhancer - one posted SCI write, safe from interrupt,
+   *          written at next gap between SDI bursts or by VS1053_ServiceSci
+   *
+   * @param   uint16_t SCI_BASS - VS10XX_BASS_PACK (treble dB, Hz, bass dB, Hz)
+   *
+   * @return  uint8_t 1 posted / 0 full
+   */
+  uint8_t VS1053_SetBass (uint16_t);
+
+  /**
+   * @brief   Set bass and treble enhancer now - main context only
+   *
+   * @param   uint16_t SCI_BASS - VS10XX_BASS_PACK (treble dB, Hz, bass dB, Hz)
+   *
+   * @return  void
+   */
+  void VS1053_SetBassNow (uint16_t);
+
+  /**
+   * @brief   Set bass and treble enhancer preset - main context only
+   *
+   * @param   enum E_Bass
+   *
+   * @return  void
+   */
+  void VS1053_SetBassPreset (enum E_Bass);
+
+  /**
+   * @brief   Record start - linear PCM, mono, samples read by VS1053_RecordRead
+   *
+   * @param   uint16_t sample rate 8000 ... 48000 Hz
+   * @param   uint16_t input - 0 microphone / SM_LINE1 line in
+   *
+   * @return  void
+   */
+  void VS1053_RecordStart (uint16_t, uint16_t);
+
+  /**
+   * @brief   Record words waiting in buffer
+   *
+   * @param   void
+   *
+   * @return  uint16_t
+   */
+  uint16_t VS1053_RecordWords (void);
+
+  /**
+   * @brief   Record read sample
+   *
+   * @param   void
+   *
+   * @return  int16_t
+   */
+  int16_t VS1053_RecordRead (void);
+
+  /**
+   * @brief   Record stop
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void VS1053_RecordStop (void);
+
 #endif
@@ -26,8 +26,6 @@
   // @includes
   #include <avr/pgmspace.h>
 
-  #define VERS_TEXT_LEN               6             // version string length definition
-
   const char ver_0[] PROGMEM = "VS1001"; 
   const char ver_1[] PROGMEM = "VS1011"; 
   const char ver_2[] PROGMEM = "VS1002"; 
@@ -48,4 +46,18 @@
     ver_7,
   };
 
+  // Sine test sample rates, order of FsIdx
+  const uint16_t vs10xx_fs[] PROGMEM = {
+    44100, 48000, 32000, 22050, 24000, 16000, 11025, 12000
+  };
+
+  // SCI_BASS presets, order of enum E_Bass
+  const uint16_t vs10xx_bass[] PROGMEM = {
+    VS10XX_BASS_PACK (0, 0, 0, 0),                // flat, enhancers off
+    VS10XX_BASS_PACK (0, 0, 12, 60),              // bass +12 dB below 60 Hz
+    VS10XX_BASS_PACK (6, 10000, 0, 0),            // treble +6 dB above 10 kHz
+    VS10XX_BASS_PACK (3, 10000, 10, 100),         // loudness
+    VS10XX_BASS_PACK (3, 3000, 0, 0),             // speech, presence above 3 kHz
+  };
+
 #endif
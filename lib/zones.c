@@ -0,0 +1,161 @@
+/**
+ * --------------------------------------------------------------------------------------+
+ * @brief       Zones - several VS1053 on one SPI bus, DREQ-aware weighted scheduler
+ * --------------------------------------------------------------------------------------+
+ * @date        18.10.2026
+ * @file        zones.c
+ * @version     1.0
+ * @test        AVR Atmega328p
+ *
+ * @depend      zones.h
+ * --------------------------------------------------------------------------------------+
+ */
+
+// INCLUDE libraries
+#include "zones.h"
+
+// global variables
+struct ZONES_Stream * _zones[ZONES_MAX];                // @var global - streams
+uint8_t _zonesCount = 0;                                // @var global - number of streams
+uint8_t _zonesRound = 0;                                // @var global - rounds since byteRate check
+uint8_t _zonesBuf[ZONES_BURST];                         // @var global - burst
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @brief   Serve stream of selected device while credit lasts and DREQ is high
+ *
+ * @param   struct ZONES_Stream *
+ *
+ * @return  void
+ */
+static void ZONES_Serve (struct ZONES_Stream * stream)
+{
+  uint16_t n;
+
+  stream->credit += stream->rate / ZONES_RATE_UNIT;
+  if (stream->credit > ZONES_CREDIT_MAX) {
+    stream->credit = ZONES_CREDIT_MAX;
+  }
+  while (stream->credit >= ZONES_BURST) {
+    n = stream->read (_zonesBuf, ZONES_BURST);
+    if (!n) {
+      stream->end = 1;                                  // end of stream
+      return;
+    }
+    VS1053_WriteBurst (_zonesBuf, (uint8_t) n);
+    stream->bytes += n;
+    stream->credit -= ZONES_BURST;
+    if (!VS1053_Ready ()) {
+      stream->credit = 0;                               // FIFO full, no banking
+      return;
+    }
+  }
+}
+
+/**
+ * +-----------------------------------------------------------------------------------+
+ * |== ZONES FUNCTIONS ================================================================|
+ * +-----------------------------------------------------------------------------------+
+ */
+
+/**
+ * @brief   Add stream to device, device has to be attached and ready
+ *
+ * @param   struct ZONES_Stream *
+ * @param   struct VS1053_Dev *
+ * @param   uint16_t (*read) (uint8_t *, uint16_t)
+ *
+ * @return  uint8_t 1 added / 0 full
+ */
+uint8_t ZONES_Add (struct ZONES_Stream * stream, struct VS1053_Dev * dev, uint16_t (*read) (uint8_t *, uint16_t))
+{
+  if (_zonesCount >= ZONES_MAX) {
+    return 0;
+  }
+  stream->dev = dev;
+  stream->read = read;
+  stream->rate = ZONES_DEFAULT_RATE;
+  stream->credit = 0;
+  stream->bytes = 0;
+  stream->end = 0;
+  _zones[_zonesCount++] = stream;
+  return 1;
+}
+
+/**
+ * @brief   Service - one round over streams, no waiting on DREQ
+ *
+ * @param   void
+ *
+ * @return  uint8_t streams not at end
+ */
+uint8_t ZONES_Service (void)
+{
+  struct VS1053_Dev * selected = VS1053_Selected ();
+  struct ZONES_Stream * stream;
+  uint16_t rate;
+  uint8_t adapt;
+  uint8_t active = 0;
+  uint8_t i;
+
+  adapt = (++_zonesRound >= ZONES_ADAPT);
+  if (adapt) {
+    _zonesRound = 0;
+  }
+  for (i = 0; i < _zonesCount; i++) {
+    stream = _zones[i];
+    if (stream->end) {
+      continue;
+    }
+    active++;
+    VS1053_Select (stream->dev);
+    if (!VS1053_Ready ()) {
+      stream->credit = 0;                               // no request, no credit
+      continue;
+    }
+    // weight by byteRate, read only while DREQ is high - SCI does not wait
+    // --------------------------------------------------------------------------------
+    if (adapt) {
+      rate = VS1053_ReadWram (VS10XX_ADDR_BYTERATE);
+      stream->rate = rate ? rate : ZONES_DEFAULT_RATE;  // 0 until first frame
+    }
+    ZONES_Serve (stream);
+  }
+  VS1053_Select (selected);
+  return active;
+}
+
+/**
+ * @brief   Remove all streams
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void ZONES_Clear (void)
+{
+  _zonesCount = 0;
+}
+
+/**
+ * @brief   Aggregate bytes sent by all streams
+ *
+ * @param   void
+ *
+ * @return  uint32_t
+ */
+uint32_t ZONES_Bytes (void)
+{
+  uint32_t bytes = 0;
+  uint8_t i;
+
+  for (i = 0; i < _zonesCount; i++) {
+    bytes += _zones[i]->bytes;
+  }
+  return bytes;
+}
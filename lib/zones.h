@@ -0,0 +1,94 @@
+/**
+ * --------------------------------------------------------------------------------------+
+ * @brief       Zones - several VS1053 on one SPI bus, DREQ-aware weighted scheduler
+ * --------------------------------------------------------------------------------------+
+ * @date        18.10.2026
+ * @file        zones.h
+ * @version     1.0
+ * @test        AVR Atmega328p
+ *
+ * @depend      vs1053.h
+ * --------------------------------------------------------------------------------------+
+ * @descr       Deficit round robin - every round stream of device with DREQ high gets
+ *              credit by its byteRate, 32 bytes bursts are sent while credit lasts and
+ *              DREQ stays high. Device with DREQ low banks no credit. On saturated bus
+ *              streams share it in ratio of bitrates, below saturation DREQ decides.
+ *
+ *              Aggregate throughput on Atmega328p 8 MHz, SPI fclk/8 = 1 MHz, PROGMEM
+ *              source (burst ~ 365 us incl. source read and scheduling, estimated from
+ *              cycle counts, shares checked by host model) -> ~ 88 kB/s of bus:
+ *                2 x 128 kbit/s    32 kB/s   36 % of bus
+ *                2 x 320 kbit/s    80 kB/s   91 % of bus, no reserve for SCI
+ *                3 x 192 kbit/s    72 kB/s   82 % of bus
+ *                4 x 128 kbit/s    64 kB/s   73 % of bus
+ *                4 x 192 kbit/s    96 kB/s   over capacity, underruns
+ * --------------------------------------------------------------------------------------+
+ * @usage       struct VS1053_Dev zone = VS1053_DEVICE (PORTC, 0, PORTC, 1, PORTB, 1, PINC, 2);
+ *              VS1053_Attach (&zone); VS1053_Select (&zone); VS1053_Init ();
+ *              ZONES_Add (&stream, &zone, read);
+ *              while (ZONES_Service ()) { ... }
+ */
+
+#ifndef __ZONES_H__
+#define __ZONES_H__
+
+  // INCLUDE libraries
+  #include "vs1053.h"
+
+  // Settings
+  #define ZONES_MAX               4       // streams
+  #define ZONES_BURST             32      // bytes per DREQ
+  #define ZONES_RATE_UNIT         500     // byteRate per byte of credit in round, 16000 B/s -> 32 B
+  #define ZONES_CREDIT_MAX        256     // credit cap, bursts in a row of one stream
+  #define ZONES_DEFAULT_RATE      16000   // byteRate until first frame, 128 kbit/s
+  #define ZONES_ADAPT             64      // rounds between byteRate checks
+
+  // @struct Stream of zone
+  struct ZONES_Stream {
+    struct VS1053_Dev * dev;                      // codec
+    uint16_t (*read) (uint8_t *, uint16_t);       // bytes read, 0 at end of stream
+    uint16_t rate;                                // byteRate, weight
+    uint16_t credit;                              // bytes allowed in this round
+    uint32_t bytes;                               // bytes sent
+    uint8_t end;                                  // end of stream
+  };
+
+  /**
+   * @brief   Add stream to device, device has to be attached and ready
+   *
+   * @param   struct ZONES_Stream *
+   * @param   struct VS1053_Dev *
+   * @param   uint16_t (*read) (uint8_t *, uint16_t)
+   *
+   * @return  uint8_t 1 added / 0 full
+   */
+  uint8_t ZONES_Add (struct ZONES_Stream *, struct VS1053_Dev *, uint16_t (*) (uint8_t *, uint16_t));
+
+  /**
+   * @brief   Service - one round over streams, no waiting on DREQ
+   *
+   * @param   void
+   *
+   * @return  uint8_t streams not at end
+   */
+  uint8_t ZONES_Service (void);
+
+  /**
+   * @brief   Remove all streams
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void ZONES_Clear (void);
+
+  /**
+   * @brief   Aggregate bytes sent by all streams
+   *
+   * @param   void
+   *
+   * @return  uint32_t
+   */
+  uint32_t ZONES_Bytes (void);
+
+#endif
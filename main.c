@@ -11,7 +11,7 @@
  * @version     1.0.0
  * @test        AVR Atmega328p
  *
- * @depend      lib/vs1053.h, lib/vs1053_hello.h
+ * @depend      lib/vs1053.h, lib/vs1053_hello.h, lib/player.h, lib/sched.h
  * --------------------------------------------------------------------------------------+
  * @interface   SPI connected through 7 pins
  * @pins        5V, DGND, MOSI, DREQ,  XCS
@@ -21,10 +21,115 @@
  */
 
 // INCLUDE libraries
+#include <avr/interrupt.h>
 #include "lib/lcd/ssd1306.h"
+#include "lib/lcd/icons.h"
+#include "labels.h"
+#include "lib/timer.h"
+#include "lib/sched.h"
+#include "lib/player.h"
 #include "lib/vs1053.h"
 #include "lib/vs1053_hello.h"
 
+// Buttons - mute / unmute, prompt, active low
+#define BUTTON_DDR              DDRC
+#define BUTTON_PORT             PORTC
+#define BUTTON_PIN              PINC
+#define BUTTON                  0
+#define BUTTON_PROMPT           1
+
+// Prompt table - clips of MP3 frames in PROGMEM
+const struct PLAYER_Clip PROMPTS[] PROGMEM = {
+  { HelloMP3, sizeof(HelloMP3)-1 }
+};
+
+// global variables
+struct SCHED_Task _taskAudio;                                     // @var global - SDI feeder
+struct SCHED_Task _taskInput;                                     // @var global - button scan
+struct SCHED_Task _taskTelemetry;                                 // @var global - sampling
+struct SCHED_Task _taskDisplay;                                   // @var global - display
+struct SSD1306_Field _fieldPlayed;                                // @var global - hellos
+struct SSD1306_Field _fieldIdle;                                  // @var global - % in sleep
+struct SSD1306_Field _fieldMisses;                                // @var global - audio misses
+struct SSD1306_Field _fieldLatency;                               // @var global - prompt latency
+uint16_t _played = 0;                                             // @var global - hellos played
+uint8_t _idle = 0;                                                // @var global - % in sleep
+uint8_t _buttons = 0xFF;                                          // @var global - debounce
+uint8_t _prompts = 0xFF;                                          // @var global - debounce
+uint8_t _muted = 0;                                               // @var global - soft mute
+
+/**
+ * @desc    Task audio - feed decoder, say Hello again at end
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void TaskAudio (void)
+{
+  if (PLAYER_Feed () == PLAYER_END) {
+    PLAYER_Close ();                                              // endFillBytes & cancel
+    PLAYER_OpenPgm (HelloMP3, sizeof(HelloMP3)-1);
+    _played++;
+  }
+}
+
+/**
+ * @desc    Task input - button pressed in 4 scans in a row toggles mute,
+ *          prompt button says Hello over stream
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void TaskInput (void)
+{
+  _buttons = (_buttons << 1) | ((BUTTON_PIN >> BUTTON) & 1);
+  if ((_buttons & 0x1F) == 0x10) {                                // released -> pressed
+    _muted = !_muted;
+    if (_muted) {
+      VS1053_Mute (200);                                          // 200 ms fade
+    } else {
+      VS1053_Unmute (200);
+    }
+  }
+  _prompts = (_prompts << 1) | ((BUTTON_PIN >> BUTTON_PROMPT) & 1);
+  if ((_prompts & 0x1F) == 0x10) {                                // released -> pressed
+    PLAYER_Prompt (0);                                            // ignored if running
+  }
+}
+
+/**
+ * @desc    Task telemetry - fraction of time in sleep
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void TaskTelemetry (void)
+{
+  struct TIMER_Load load;
+
+  TIMER_GetLoad (&load);
+  _idle = (uint8_t) ((uint32_t) load.idle * 100 / (load.ticks ? load.ticks : 1));
+}
+
+/**
+ * @desc    Task display - changed digits only
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void TaskDisplay (void)
+{
+  SSD1306_FieldNumber (&_fieldPlayed, _played);
+  SSD1306_FieldNumber (&_fieldIdle, _idle);
+  SSD1306_FieldNumber (&_fieldMisses, _taskAudio.misses);
+  SSD1306_FieldNumber (&_fieldLatency, PLAYER_PromptLatency ());
+  SSD1306_Flush ();                                               // send framebuffer
+}
+
 /**
  * @desc    Main function
  *
@@ -36,55 +141,90 @@ int main (void)
 {
   uint16_t data;
 
+  // 1 ms tick for volume fades
+  // -------------------------------------------------------------------------------------
+  TIMER_Init ();
+  TIMER_SetHook (VS1053_FadeTick);
+
+  // enable interrupts for queued TWI transfers and tick
+  // -------------------------------------------------------------------------------------
+  sei ();
+
   // init LCD SSD1306
   // -------------------------------------------------------------------------------------
   SSD1306_Init (SSD1306_ADDR);
   SSD1306_ClearScreen ();
   SSD1306_SetPosition (10, 0);
-  SSD1306_DrawString ("VS10XX AUDIO CODEC", NORMAL);
+  SSD1306_DrawLabel (LABEL_TITLE);
+  SSD1306_Flush ();                                               // send framebuffer
 
   // init MP3 decoder
   // -------------------------------------------------------------------------------------
   SSD1306_SetPosition (1, 2);
-  SSD1306_DrawString ("VS10XX init", NORMAL);
+  SSD1306_DrawLabel (LABEL_INIT);
+  SSD1306_Flush ();                                               // send framebuffer
   VS1053_Init ();                                                 // init decoder
   SSD1306_SetPosition (103, 2);
-  SSD1306_DrawString ("[OK]", NORMAL);
+  SSD1306_DrawLabel (LABEL_OK);
+  SSD1306_Flush ();                                               // send framebuffer
  
   // mem test
   // -------------------------------------------------------------------------------------
   SSD1306_SetPosition (1, 3);
-  SSD1306_DrawString ("VS10XX memtest", NORMAL);
+  SSD1306_DrawLabel (LABEL_MEMTEST);
+  SSD1306_Flush ();                                               // send framebuffer
   SSD1306_SetPosition (103, 3);
   data = VS1053_TestMemory ();   
   if (data != VS1053_MEMTEST_OK) { 
     return 0;                                                     // mem test fail
   }
-  SSD1306_DrawString ("[OK]", NORMAL);
+  SSD1306_DrawLabel (LABEL_OK);
+  SSD1306_Flush ();                                               // send framebuffer
 
   // sine test
   // -------------------------------------------------------------------------------------
   SSD1306_SetPosition (1, 4);
-  SSD1306_DrawString ("VS10XX sinetest", NORMAL);
+  SSD1306_DrawLabel (LABEL_SINETEST);
+  SSD1306_Flush ();                                               // send framebuffer
   VS1053_TestSine (VS10XX_FREQ_1kHz);                             // sine test 1kHz
   VS1053_TestSine (VS10XX_FREQ_5kHz);                             // sine test 5kHz
   SSD1306_SetPosition (103, 4);
-  SSD1306_DrawString ("[OK]", NORMAL);
+  SSD1306_DrawLabel (LABEL_OK);
+  SSD1306_Flush ();                                               // send framebuffer
 
   // get version of MP3 decoder
   // -------------------------------------------------------------------------------------
   SSD1306_SetPosition (10, 0);
   SSD1306_DrawString (VS1053_GetVersion (), UNDERLINE);           // print version
+  SSD1306_Flush ();                                               // send framebuffer
   
   // test say hello
   // http://www.vsdsp-forum.com/phpbb/viewtopic.php?t=65
   // -------------------------------------------------------------------------------------
   SSD1306_SetPosition (1, 5);
-  SSD1306_DrawString ("VS10XX say hello", NORMAL);
+  SSD1306_DrawLabel (LABEL_HELLO);
   SSD1306_SetPosition (103, 5);
-  SSD1306_DrawString ("[OK]", NORMAL);
+  SSD1306_DrawLabel (LABEL_OK);
+  SSD1306_Flush ();                                               // send framebuffer
+  SSD1306_DrawBitmap (1, 48, ICON_PLAY);                          // page 6
+  SSD1306_FieldInit (&_fieldPlayed, 12, 6, 5, NORMAL, 0);         // counter of hellos
+  SSD1306_FieldInit (&_fieldIdle, 103, 6, 3, NORMAL, 0);          // % of time in sleep
+  SSD1306_FieldInit (&_fieldMisses, 12, 7, 5, NORMAL, 0);         // audio deadline misses
+  SSD1306_FieldInit (&_fieldLatency, 97, 7, 4, NORMAL, 0);        // prompt latency [ms]
+
+  // tasks, audio feed first
+  // -------------------------------------------------------------------------------------
+  BUTTON_DDR &= ~((1 << BUTTON) | (1 << BUTTON_PROMPT));          // buttons as input
+  BUTTON_PORT |= (1 << BUTTON) | (1 << BUTTON_PROMPT);            // pullup
+  PLAYER_SetPrompts (PROMPTS, sizeof(PROMPTS) / sizeof(PROMPTS[0]));
+  VS1053_SoftReset ();                                            // decoder ready
+  PLAYER_OpenPgm (HelloMP3, sizeof(HelloMP3)-1);
+  SCHED_Add (&_taskAudio, TaskAudio, 2, 4, 0);                    // 2 ms, FIFO lasts 50 ms
+  SCHED_Add (&_taskInput, TaskInput, 10, 10, 1);                  // 10 ms scan
+  SCHED_Add (&_taskTelemetry, TaskTelemetry, 1000, 100, 1);       // 1 s sample
+  SCHED_Add (&_taskDisplay, TaskDisplay, 100, 100, 2);            // 10 fps
   while (1) {
-    VS1053_TestSample (HelloMP3, sizeof(HelloMP3)-1);             // say Hello
+    SCHED_Run ();
   }
 
   // EXIT
@@ -0,0 +1,162 @@
+/**
+ * --------------------------------------------------------------------------------------+
+ * @brief       Host test - stream format of seek index
+ * --------------------------------------------------------------------------------------+
+ * @date        18.10.2026
+ * @file        format_test.c
+ * @version     1.0
+ * @test        host gcc
+ *
+ * @depend      lib/index.h
+ * --------------------------------------------------------------------------------------+
+ * @descr       RIFF / WAV with sync-like bytes in PCM, fLaC and ADTS must give
+ *              INDEX_OFF with no lookup and no next frame; MPEG audio frames, also
+ *              after ID3v2 tag, give INDEX_MP3.
+ * --------------------------------------------------------------------------------------+
+ * @usage       gcc -Itests/host -Ilib tests/format_test.c lib/index.c -o format_test
+ *              ./format_test
+ */
+
+// INCLUDE libraries
+#include <stdio.h>
+#include <string.h>
+#include "index.h"
+
+// Test stream
+#define TEST_LENGTH             16384
+#define TEST_FRAME              417     // MPEG1 layer III, 128 kbit/s, 44100 Hz
+
+uint8_t _stream[TEST_LENGTH];                           // @var global - test stream
+uint16_t _failed = 0;                                   // @var global - failed checks
+
+/**
+ * @brief   Check
+ *
+ * @param   int condition
+ * @param   const char * name
+ *
+ * @return  void
+ */
+static void TEST_Check (int ok, const char * name)
+{
+  printf ("%s %s\n", ok ? "ok  " : "FAIL", name);
+  if (!ok) {
+    _failed++;
+  }
+}
+
+/**
+ * @brief   Scan stream in 32 bytes bursts as sent to decoder
+ *
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+static void TEST_Scan (uint16_t length)
+{
+  uint16_t offset;
+  uint8_t n;
+
+  INDEX_Init ();
+  for (offset = 0; offset < length; offset += n) {
+    n = (length - offset > 32) ? 32 : (uint8_t) (length - offset);
+    INDEX_Scan (&_stream[offset], n, offset);
+  }
+}
+
+/**
+ * @brief   PCM payload with MPEG sync-like words
+ *
+ * @param   uint16_t from
+ *
+ * @return  void
+ */
+static void TEST_Pcm (uint16_t from)
+{
+  uint16_t i;
+
+  for (i = from; i < TEST_LENGTH; i++) {
+    _stream[i] = (uint8_t) (i * 37);
+  }
+  for (i = from + 1000; i + 4 < TEST_LENGTH; i += 3000) {
+    memcpy (&_stream[i], "\xFF\xFB\x90\x64", 4);        // false frame header
+  }
+}
+
+/**
+ * @brief   MPEG audio frames
+ *
+ * @param   uint16_t from
+ *
+ * @return  void
+ */
+static void TEST_Mp3 (uint16_t from)
+{
+  uint16_t i;
+
+  memset (&_stream[from], 0x55, TEST_LENGTH - from);
+  for (i = from; i + 4 <= TEST_LENGTH; i += TEST_FRAME) {   // last frame cut
+    memcpy (&_stream[i], "\xFF\xFB\x90\x64", 4);
+  }
+}
+
+/**
+ * @brief   Unknown format - no index, no frame
+ *
+ * @param   const char * name
+ *
+ * @return  void
+ */
+static void TEST_Off (const char * name)
+{
+  uint32_t offset;
+
+  TEST_Scan (TEST_LENGTH);
+  TEST_Check (INDEX_Format () == INDEX_OFF, name);
+  TEST_Check (!INDEX_Frame (&offset), "  no next frame");
+  TEST_Check (!INDEX_Lookup (INDEX_TICKS, &offset) && !INDEX_Entries (), "  no lookup");
+}
+
+/**
+ * @brief   Main
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  uint32_t offset;
+
+  // RIFF / WAV header, 16 bit stereo PCM
+  // ----------------------------------------------------------------------------------
+  memcpy (_stream, "RIFF\xFF\xFF\xFF\xFFWAVEfmt \x10\0\0\0\x01\0\x02\0\x22\x56\0\0"
+                   "\x88\x58\x01\0\x04\0\x10\0data\xFF\xFF\xFF\xFF", 44);
+  TEST_Pcm (44);
+  TEST_Off ("WAV is INDEX_OFF");
+
+  // FLAC, AAC ADTS
+  // ----------------------------------------------------------------------------------
+  memcpy (_stream, "fLaC", 4);
+  TEST_Pcm (4);
+  TEST_Off ("FLAC is INDEX_OFF");
+  memcpy (_stream, "\xFF\xF1\x50\x80", 4);
+  TEST_Pcm (4);
+  TEST_Off ("ADTS is INDEX_OFF");
+
+  // MPEG audio, plain and after ID3v2 tag
+  // ----------------------------------------------------------------------------------
+  TEST_Mp3 (0);
+  TEST_Scan (TEST_LENGTH);
+  TEST_Check (INDEX_Format () == INDEX_MP3, "MP3 is INDEX_MP3");
+  TEST_Check (INDEX_Frame (&offset) && ((offset % TEST_FRAME) == 0), "  next frame on header");
+  memcpy (_stream, "ID3\x04\0\0\0\0\x07\x76", 10);     // tag of 1014 + 10 B
+  memset (&_stream[10], 0, 1014);
+  TEST_Mp3 (1024);
+  TEST_Scan (TEST_LENGTH);
+  TEST_Check (INDEX_Format () == INDEX_MP3, "ID3 + MP3 is INDEX_MP3");
+  TEST_Check (INDEX_Frame (&offset) && (((offset - 1024) % TEST_FRAME) == 0), "  next frame on header");
+
+  printf ("%u failed\n", _failed);
+  return _failed ? 1 : 0;
+}
@@ -0,0 +1,4 @@
+/* host shim */
+#define ISR(vector) void vector (void)
+#define sei()
+#define cli()
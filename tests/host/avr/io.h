@@ -0,0 +1,2 @@
+/* host shim - no registers, headers only */
+#include <stdint.h>
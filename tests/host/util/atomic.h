@@ -0,0 +1,3 @@
+/* host shim - single thread */
+#define ATOMIC_RESTORESTATE
+#define ATOMIC_BLOCK(type) for (int _atomic = 1; _atomic; _atomic = 0)
@@ -0,0 +1,3 @@
+/* host shim */
+#define _delay_ms(ms)
+#define _delay_us(us)
@@ -0,0 +1,197 @@
+/**
+ * --------------------------------------------------------------------------------------+
+ * @brief       Host test - prompt over stream of known / unknown format
+ * --------------------------------------------------------------------------------------+
+ * @date        18.10.2026
+ * @file        prompt_test.c
+ * @version     1.0
+ * @test        host gcc
+ *
+ * @depend      lib/player.h, lib/index.h
+ * --------------------------------------------------------------------------------------+
+ * @descr       Decoder and timer are stubs, SDI bytes are counted. Raw PCM source
+ *              (RIFF / WAV with sync-like bytes in payload) gives INDEX_OFF and
+ *              PLAYER_Prompt returns PLAYER_ERROR, prompt given before first bytes
+ *              is dropped unplayed. MP3 stream is cut at frame header and clip
+ *              is sent whole.
+ * --------------------------------------------------------------------------------------+
+ * @usage       gcc -Itests/host -Ilib tests/prompt_test.c lib/player.c lib/index.c -o prompt_test
+ *              ./prompt_test
+ */
+
+// INCLUDE libraries
+#include <stdio.h>
+#include <string.h>
+#include "player.h"
+#include "index.h"
+#include "timer.h"
+
+// Test stream
+#define TEST_LENGTH             16384
+#define TEST_FRAME              417     // MPEG1 layer III, 128 kbit/s, 44100 Hz
+#define TEST_CLIP               834     // two frames
+#define TEST_READY              16      // bursts taken by decoder per feed
+
+uint8_t _stream[TEST_LENGTH];                           // @var global - test stream
+uint16_t _streamOffset;                                 // @var global - source position
+uint8_t _clip[TEST_CLIP];                               // @var global - prompt clip
+uint32_t _sdiBytes;                                     // @var global - bytes sent to decoder
+uint32_t _sdiCut;                                       // @var global - bytes before clip
+uint16_t _clipBytes;                                    // @var global - clip bytes sent
+uint8_t _ready;                                         // @var global - bursts left
+uint16_t _failed = 0;                                   // @var global - failed checks
+
+const struct PLAYER_Clip _prompts[] = {
+  { (const char *) _clip, TEST_CLIP }
+};
+
+/**
+ * +-----------------------------------------------------------------------------------+
+ * |== DECODER STUB ===================================================================|
+ * +-----------------------------------------------------------------------------------+
+ */
+
+/* Clip starts at cut (decode time saved), ends when decode time is restored */
+void VS1053_WriteBurst (const uint8_t * data, uint8_t n) { (void) data; _sdiBytes += n; _ready--; }
+uint16_t VS1053_GetDecodeTime (void) { _sdiCut = _sdiBytes; return 0; }
+void VS1053_SetDecodeTime (uint16_t time) { (void) time; _clipBytes = _sdiBytes - _sdiCut; }
+uint8_t VS1053_Ready (void) { return _ready ? 1 : 0; }
+void VS1053_WriteSdiByte (uint8_t byte, uint16_t n) { (void) byte; _sdiBytes += n; }
+uint16_t VS1053_ReadSci (uint8_t addr) { (void) addr; return 0; }
+uint16_t VS1053_ReadWram (uint16_t addr) { (void) addr; return 0; }
+uint8_t VS1053_PostSci (uint8_t addr, uint16_t value) { (void) addr; (void) value; return 1; }
+void VS1053_ServiceSci (void) { }
+uint16_t VS1053_PlayCancel (void) { return 0; }
+void VS1053_SetPlaySpeed (uint16_t speed) { (void) speed; }
+uint8_t VS1053_CanJump (void) { return 1; }
+uint16_t TIMER_Ticks (void) { return 0; }
+
+/**
+ * +-----------------------------------------------------------------------------------+
+ * |== SOURCE =========================================================================|
+ * +-----------------------------------------------------------------------------------+
+ */
+
+static uint16_t TEST_Read (uint8_t * buffer, uint16_t n)
+{
+  if (n > TEST_LENGTH - _streamOffset) {
+    n = TEST_LENGTH - _streamOffset;
+  }
+  memcpy (buffer, &_stream[_streamOffset], n);
+  _streamOffset += n;
+  return n;
+}
+
+static uint8_t TEST_End (void) { return _streamOffset >= TEST_LENGTH; }
+
+const struct PLAYER_Source _source = { TEST_Read, 0, TEST_End };
+
+/**
+ * +-----------------------------------------------------------------------------------+
+ * |== TEST ===========================================================================|
+ * +-----------------------------------------------------------------------------------+
+ */
+
+/**
+ * @brief   Check
+ *
+ * @param   int condition
+ * @param   const char * name
+ *
+ * @return  void
+ */
+static void TEST_Check (int ok, const char * name)
+{
+  printf ("%s %s\n", ok ? "ok  " : "FAIL", name);
+  if (!ok) {
+    _failed++;
+  }
+}
+
+/**
+ * @brief   Feed as main loop does, decoder takes some bursts each time
+ *
+ * @param   uint8_t calls
+ *
+ * @return  void
+ */
+static void TEST_Feed (uint8_t calls)
+{
+  while (calls--) {
+    _ready = TEST_READY;
+    if (PLAYER_Feed () == PLAYER_END) {
+      break;
+    }
+  }
+}
+
+/**
+ * @brief   Reset stream and counters
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void TEST_Reset (void)
+{
+  _streamOffset = 0;
+  _sdiBytes = 0;
+  _sdiCut = 0;
+  _clipBytes = 0;
+}
+
+/**
+ * @brief   Main
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  uint16_t i;
+
+  // clip, two frames
+  // ----------------------------------------------------------------------------------
+  memset (_clip, 0xAA, TEST_CLIP);
+  memcpy (&_clip[0], "\xFF\xFB\x90\x64", 4);
+  memcpy (&_clip[TEST_FRAME], "\xFF\xFB\x90\x64", 4);
+  PLAYER_SetPrompts (_prompts, 1);
+
+  // PCM payload with MPEG sync-like words, header is generated by player
+  // ----------------------------------------------------------------------------------
+  for (i = 0; i < TEST_LENGTH; i++) {
+    _stream[i] = (uint8_t) (i * 37);
+  }
+  for (i = 1000; i + 4 < TEST_LENGTH; i += 3000) {
+    memcpy (&_stream[i], "\xFF\xFB\x90\x64", 4);        // false frame header
+  }
+  TEST_Reset ();
+  PLAYER_OpenPcm (&_source, 22050, 2, 16);
+  TEST_Check (PLAYER_Prompt (0) == PLAYER_SUCCESS, "PCM prompt before first bytes pending");
+  TEST_Feed (64);
+  TEST_Check (INDEX_Format () == INDEX_OFF, "  WAV is INDEX_OFF");
+  TEST_Check (!PLAYER_PromptBusy () && !_clipBytes, "  pending prompt dropped unplayed");
+  TEST_Check (PLAYER_Prompt (0) == PLAYER_ERROR, "  prompt is PLAYER_ERROR");
+  TEST_Check (!PLAYER_PromptBusy (), "  no prompt running");
+  PLAYER_Close ();
+
+  // MP3 stream, frames to the end
+  // ----------------------------------------------------------------------------------
+  memset (_stream, 0x55, TEST_LENGTH);
+  for (i = 0; i + 4 <= TEST_LENGTH; i += TEST_FRAME) {
+    memcpy (&_stream[i], "\xFF\xFB\x90\x64", 4);
+  }
+  TEST_Reset ();
+  PLAYER_Open (&_source);
+  TEST_Feed (4);
+  TEST_Check (INDEX_Format () == INDEX_MP3, "MP3 is INDEX_MP3");
+  TEST_Check (PLAYER_Prompt (0) == PLAYER_SUCCESS, "  prompt is PLAYER_SUCCESS");
+  TEST_Feed (64);
+  TEST_Check (!PLAYER_PromptBusy () && (_clipBytes == TEST_CLIP), "  clip sent whole");
+  TEST_Check (_sdiCut && !(_sdiCut % TEST_FRAME), "  stream cut at frame header");
+  PLAYER_Close ();
+
+  printf ("%u failed\n", _failed);
+  return _failed ? 1 : 0;
+}
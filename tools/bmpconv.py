@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+#
+# @description  Convert PBM / PNG images into packed bitmaps for SSD1306_DrawBitmap
+#
+# @notes        Output array: width, height, pages packed by run-length code.
+#               Bytes are ordered page by page as written to display in horizontal
+#               addressing mode, bit 0 is the top row of page:
+#                 0x00 ... 0x7F  - (n + 1) literal bytes follow
+#                 0x80 ... 0xFF  - next byte repeated (n - 0x80 + 3) times
+#               PBM is read natively, 1 (black) is lit pixel. Other formats need
+#               Pillow, dark pixel is lit; --invert swaps it for light on dark art.
+#
+# @usage        python3 tools/bmpconv.py [--invert] NAME image.pbm [NAME image.png ...] > icons.h
+#
+import os
+import sys
+
+
+def read_pbm(path):
+  with open(path, 'rb') as f:
+    raw = f.read()
+  tokens, i = [], 0
+  # header tokens: magic, width, height, comments skipped
+  # ------------------------------------------------------------------
+  while len(tokens) < 3:
+    while raw[i:i + 1].isspace():
+      i += 1
+    if raw[i:i + 1] == b'#':
+      while raw[i:i + 1] not in (b'\n', b''):
+        i += 1
+      continue
+    j = i
+    while not raw[j:j + 1].isspace():
+      j += 1
+    tokens.append(raw[i:j])
+    i = j
+  magic, width, height = tokens[0], int(tokens[1]), int(tokens[2])
+  if magic == b'P1':
+    bits = [c == ord('1') for c in raw[i:] if c in b'01']
+    return [bits[y * width:(y + 1) * width] for y in range(height)]
+  if magic == b'P4':
+    i += 1                                            # single whitespace
+    stride = (width + 7) // 8
+    return [[bool(raw[i + y * stride + x // 8] & (0x80 >> (x % 8))) for x in range(width)]
+            for y in range(height)]
+  raise ValueError('%s: not a PBM image' % path)
+
+
+def read_image(path, invert):
+  if path.lower().endswith('.pbm'):
+    bitmap = read_pbm(path)
+  else:
+    from PIL import Image
+    im = Image.open(path).convert('L')
+    bitmap = [[im.getpixel((x, y)) < 128 for x in range(im.width)] for y in range(im.height)]
+  if invert:
+    bitmap = [[not p for p in row] for row in bitmap]
+  return bitmap
+
+
+def pages(bitmap):
+  width, height = len(bitmap[0]), len(bitmap)
+  data = []
+  for page in range((height + 7) // 8):
+    for x in range(width):
+      byte = 0
+      for bit in range(8):
+        y = page * 8 + bit
+        if y < height and bitmap[y][x]:
+          byte |= 1 << bit
+      data.append(byte)
+  return data
+
+
+def pack(data):
+  out, i = [], 0
+  while i < len(data):
+    run = 1
+    while i + run < len(data) and data[i + run] == data[i] and run < 130:
+      run += 1
+    if run >= 3:
+      out += [0x80 + run - 3, data[i]]
+      i += run
+      continue
+    j = i
+    while j < len(data) and j - i < 128:
+      if j + 2 < len(data) and data[j] == data[j + 1] == data[j + 2]:
+        break
+      j += 1
+    out += [j - i - 1] + data[i:j]
+    i = j
+  return out
+
+
+def main(argv):
+  invert = '--invert' in argv
+  argv = [a for a in argv if a != '--invert']
+  if not argv or len(argv) % 2:
+    sys.exit('usage: bmpconv.py [--invert] NAME image [NAME image ...]')
+  print('  // Generated by tools/bmpconv.py, {width, height, packed pages}')
+  for name, path in zip(argv[0::2], argv[1::2]):
+    bitmap = read_image(path, invert)
+    width, height = len(bitmap[0]), len(bitmap)
+    if width > 128 or height > 64:
+      sys.exit('%s: %dx%d is larger than display' % (path, width, height))
+    data = pages(bitmap)
+    packed = pack(data)
+    print('  // %s, %dx%d, %d B packed (raw %d B)' % (os.path.basename(path), width, height,
+                                                   len(packed) + 2, len(data) + 2))
+    print('  static const uint8_t %s[] PROGMEM = {' % name)
+    print('    %d, %d,' % (width, height))
+    for k in range(0, len(packed), 16):
+      print('    ' + ', '.join('0x%02x' % v for v in packed[k:k + 16]) + ',')
+    print('  };')
+
+
+if __name__ == '__main__':
+  main(sys.argv[1:])
@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+#
+# @description  Generate packed multi-page fonts for SSD1306 (lib/lcd/font_large.h)
+#
+# @notes        Glyphs are rasterized from DejaVu Sans Mono Bold (Bitstream Vera
+#               derived license) and stored page by page in display order:
+#               page 0 columns, page 1 columns, ... Every glyph is packed by
+#               run-length code:
+#                 0x00 ... 0x7F  - (n + 1) literal bytes follow
+#                 0x80 ... 0xFF  - next byte repeated (n - 0x80 + 3) times
+#
+# @usage        python3 tools/fontgen.py [path to DejaVuSansMono-Bold.ttf] > lib/lcd/font_large.h
+#               requires Pillow
+#
+import sys
+from PIL import Image, ImageDraw, ImageFont
+
+TTF = sys.argv[1] if len(sys.argv) > 1 else '/usr/share/fonts/truetype/dejavu/DejaVuSansMono-Bold.ttf'
+
+
+def raster_8x16(ch):
+  font = ImageFont.truetype(TTF, 15)
+  im = Image.new('L', (8, 16), 0)
+  d = ImageDraw.Draw(im)
+  box = d.textbbox((0, 0), ch, font=font)
+  d.text(((8 - (box[2] - box[0])) // 2 - box[0], -2), ch, font=font, fill=255)
+  return [[im.getpixel((x, y)) > 110 for x in range(8)] for y in range(16)]
+
+
+def raster_16x32(ch):
+  font = ImageFont.truetype(TTF, 64)
+  im = Image.new('L', (64, 128), 0)
+  d = ImageDraw.Draw(im)
+  d.text((0, 0), '0', font=font, fill=255)
+  box = im.getbbox()                                  # every glyph scaled by box of '0'
+  im = Image.new('L', (64, 128), 0)
+  d = ImageDraw.Draw(im)
+  d.text((0, 0), ch, font=font, fill=255)
+  glyph = im.crop(box).resize((14, 28), Image.LANCZOS)
+  out = Image.new('L', (16, 32), 0)
+  out.paste(glyph, (1, 2))
+  return [[out.getpixel((x, y)) > 100 for x in range(16)] for y in range(32)]
+
+
+def pages(bitmap):
+  width, height = len(bitmap[0]), len(bitmap)
+  data = []
+  for page in range(height // 8):
+    for x in range(width):
+      byte = 0
+      for bit in range(8):
+        if bitmap[page * 8 + bit][x]:
+          byte |= 1 << bit
+      data.append(byte)
+  return data
+
+
+def pack(data):
+  out, i = [], 0
+  while i < len(data):
+    run = 1
+    while i + run < len(data) and data[i + run] == data[i] and run < 130:
+      run += 1
+    if run >= 3:
+      out += [0x80 + run - 3, data[i]]
+      i += run
+      continue
+    j = i
+    while j < len(data) and j - i < 128:
+      if j + 2 < len(data) and data[j] == data[j + 1] == data[j + 2]:
+        break
+      j += 1
+    out += [j - i - 1] + data[i:j]
+    i = j
+  return out
+
+
+def emit(name, chars, raster, width, pages_n):
+  glyphs = [pages(raster(ch)) for ch in chars]
+  packed = [pack(g) for g in glyphs]
+  raw = len(chars) * width * pages_n
+  size = sum(len(g) for g in packed) + 2 * len(chars)
+  # run-length code only if it pays for the index
+  # ------------------------------------------------------------------
+  if size >= raw:
+    print('  // %dx%d, chars 0x%02x ... 0x%02x, raw %d B (packed would be %d B with index)'
+          % (width, pages_n * 8, ord(chars[0]), ord(chars[-1]), raw, size))
+    print('  static const uint8_t %s_DATA[] PROGMEM = {' % name)
+    for ch, g in zip(chars, glyphs):
+      print('    ' + ', '.join('0x%02x' % v for v in g) + ', // %02x %s' % (ord(ch), ch if ch != '\\' else 'backslash'))
+    print('  };')
+    return 0
+  print('  // %dx%d, chars 0x%02x ... 0x%02x, %d B packed with index (raw %d B)'
+        % (width, pages_n * 8, ord(chars[0]), ord(chars[-1]), size, raw))
+  index, offset = [], 0
+  for g in packed:
+    index.append(offset)
+    offset += len(g)
+  print('  static const uint16_t %s_INDEX[] PROGMEM = {' % name)
+  for k in range(0, len(index), 12):
+    print('    ' + ', '.join('%d' % v for v in index[k:k + 12]) + ',')
+  print('  };')
+  print('  static const uint8_t %s_DATA[] PROGMEM = {' % name)
+  for ch, g in zip(chars, packed):
+    print('    ' + ', '.join('0x%02x' % v for v in g) + ', // %02x %s' % (ord(ch), ch if ch != '\\' else 'backslash'))
+  print('  };')
+  return 1
+
+
+print('''/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        LCD FONTS 8x16, 16x32 digits (packed)
+ * -------------------------------------------------------------------------------------+
+ * @source      Generated by tools/fontgen.py from DejaVu Sans Mono Bold
+ *
+ * @file        font_large.h
+ * @version     1.0
+ * @tested      AVR Atmega328p
+ *
+ * @depend      avr/pgmspace.h
+ * -------------------------------------------------------------------------------------+
+ * @descr       Glyph bytes are ordered page by page as written to display in horizontal
+ *              addressing mode. Font with index is packed by run-length code:
+ *                0x00 ... 0x7F - (n + 1) literal bytes follow
+ *                0x80 ... 0xFF - next byte repeated (n - 0x80 + 3) times
+ * -------------------------------------------------------------------------------------+
+ * @usage       SSD1306_DrawStringBig (str, &FONT_8X16)
+ */
+
+#ifndef __FONT_LARGE_H__
+#define __FONT_LARGE_H__
+
+  // includes
+  #include <avr/pgmspace.h>
+
+  // @struct Packed font
+  struct FONT_Packed {
+    uint8_t width;                            // columns of glyph
+    uint8_t pages;                            // pages of glyph
+    char first;                               // first character
+    char last;                                // last character
+    const uint16_t * index;                   // glyph offsets in data, 0 if not packed
+    const uint8_t * data;                     // glyphs
+  };
+''')
+fonts = [('FONT_8X16', 0x20, 0x7e, raster_8x16, 8, 2), ('FONT_16X32', 0x30, 0x3a, raster_16x32, 16, 4)]
+packed = []
+for name, first, last, raster, width, pages_n in fonts:
+  packed.append(emit(name, [chr(c) for c in range(first, last + 1)], raster, width, pages_n))
+  print()
+print('  // @const Fonts')
+for (name, first, last, raster, width, pages_n), p in zip(fonts, packed):
+  print('  static const struct FONT_Packed %s PROGMEM = { %d, %d, 0x%02x, 0x%02x, %s, %s_DATA };'
+        % (name, width, pages_n, first, last, name + '_INDEX' if p else '0', name))
+print('''
+#endif''')
@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+#
+# @description  Pre-render constant labels into column bitmaps for SSD1306_DrawLabel
+#
+# @notes        Glyphs are taken from FONTS in lib/lcd/font.h, so the columns are
+#               exactly what SSD1306_DrawString would send: 5 columns + 1 empty
+#               column per char, bold doubles columns, underline sets bit 7.
+#               Label list, one per line, '#' starts comment:
+#                 NAME "text" [NORMAL|BOLD|UNDERLINE]
+#
+# @usage        python3 tools/labelgen.py labels.txt lib/lcd/font.h > labels.h
+#
+import re
+import sys
+
+
+def read_font(path):
+  glyphs = []
+  with open(path) as f:
+    for line in f:
+      m = re.match(r'\s*\{([^}]*)\}\s*,?\s*//', line)
+      if m:
+        glyphs.append([int(v, 16) for v in m.group(1).split(',') if v.strip()])
+  return glyphs
+
+
+def read_labels(path):
+  labels = []
+  with open(path) as f:
+    for n, line in enumerate(f, 1):
+      line = line.strip()
+      if not line or line.startswith('#'):
+        continue
+      m = re.match(r'(\w+)\s+"((?:[^"\\]|\\.)*)"\s*(\w+)?$', line)
+      if not m:
+        sys.exit('%s:%d: expected NAME "text" [NORMAL|BOLD|UNDERLINE]' % (path, n))
+      font = m.group(3) or 'NORMAL'
+      if font not in ('NORMAL', 'BOLD', 'UNDERLINE'):
+        sys.exit('%s:%d: unknown font %s' % (path, n, font))
+      labels.append((m.group(1), re.sub(r'\\(.)', r'\1', m.group(2)), font))
+  return labels
+
+
+def render(text, font, glyphs):
+  mask = 0x80 if font == 'UNDERLINE' else 0x00
+  cols = []
+  for ch in text:
+    code = ord(ch) - 0x20
+    if code < 0 or code >= len(glyphs):
+      sys.exit('"%s": char 0x%02x is not in font' % (text, ord(ch)))
+    for byte in glyphs[code]:
+      cols += [byte | mask] * (2 if font == 'BOLD' else 1)
+    cols.append(mask)                                 # one empty column
+  return cols
+
+
+def main(argv):
+  if len(argv) != 2:
+    sys.exit('usage: labelgen.py labels.txt font.h')
+  glyphs = read_font(argv[1])
+  labels = read_labels(argv[0])
+  print('''/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        Pre-rendered labels
+ * -------------------------------------------------------------------------------------+
+ * @source      Generated by tools/labelgen.py from %s, do not edit
+ *
+ * @file        labels.h
+ * @tested      AVR Atmega328p
+ *
+ * @depend      avr/pgmspace.h
+ * -------------------------------------------------------------------------------------+
+ * @descr       Columns of 5x8 font as sent by SSD1306_DrawString: {width, columns}
+ * -------------------------------------------------------------------------------------+
+ * @usage       SSD1306_DrawLabel (LABEL_NAME)
+ */
+
+#ifndef __LABELS_H__
+#define __LABELS_H__
+
+  // includes
+  #include <avr/pgmspace.h>
+''' % argv[0])
+  for name, text, font in labels:
+    cols = render(text, font, glyphs)
+    if len(cols) > 128:
+      sys.exit('"%s": %d columns is wider than display' % (text, len(cols)))
+    print('  // "%s", %s, %d B' % (text, font, len(cols) + 1))
+    print('  static const uint8_t %s[] PROGMEM = {' % name)
+    print('    %d,' % len(cols))
+    for k in range(0, len(cols), 16):
+      print('    ' + ', '.join('0x%02x' % v for v in cols[k:k + 16]) + ',')
+    print('  };')
+    print()
+  print('#endif')
+
+
+if __name__ == '__main__':
+  main(sys.argv[1:])